@@ -1,1550 +1,7060 @@
-/*
-  The MIT License (MIT)
-
-  library writen by Kris Kasprzak
-
-  Permission is hereby granted, free of charge, to any person obtaining a copy of
-  this software and associated documentation files (the "Software"), to deal in
-  the Software without restriction, including without limitation the rights to
-  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
-  the Software, and to permit persons to whom the Software is furnished to do so,
-  subject to the following conditions:
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
-  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
-  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
-  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
-
-  On a personal note, if you develop an application or product using this library
-  and make millions of dollars, I'm happy for you!
-
-*/
-
-#include <Adafruit_ST7735_Menu.h>  
-#include "Adafruit_GFX.h"
-#include "Adafruit_ST7735.h"
-
-EditMenu::EditMenu(Adafruit_ST7735 *Display, bool EnableTouch) {
-  d = Display;
-  enabletouch = EnableTouch;
-}
-
-void EditMenu::init(uint16_t TextColor, uint16_t BackgroundColor,
-                    uint16_t HighlightTextColor, uint16_t HighlightColor,
-                    uint16_t SelectedTextColor, uint16_t SelectedColor,
-                    uint16_t MenuColumn, uint16_t ItemRowHeight, uint16_t MaxRow,
-                    const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont) {
-
-  itc = TextColor;
-  ibc = BackgroundColor;
-  ihtc = HighlightTextColor;
-  ihbc = HighlightColor;
-  istc = SelectedTextColor;
-  isbc = SelectedColor;
-
-  bcolor = TextColor;
-  sbcolor = TextColor;
-  tbt = 0;        // title bar top
-  tbl = 0;        // title bar left
-  tbh = 40;       // title bar height
-  tbw = d->width(); // title bar width, default to screen width
-  tox = 20;       // x pixel offset for title text to manage centering
-  toy  = 8;       // y pixel offset for title text to manage height centering
-  isx = 10;       // where to start the menu item from left, default indent 10
-  mm = 5;
-  // isy = tbt + tbh - ItemRowHeight + mm;  // where to start the menu item from top, default below menu bar by 10, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
-
-  isy = tbt + tbh + mm;  // where to start the menu item from top, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
-
-  irh = ItemRowHeight;  // select bar height
-  irw = tbw - isx;    // select bar width, default to full width
-  col = MenuColumn;
-  imr = MaxRow;     // user has to indicate this
-  iox = 0;  // pixels to offset text in menu bar
-  ioy = 0;  // pixels to offset text in menu bar
-  itemf = &ItemFont;     // item font
-  titlef = &TitleFont;     // title font
-  ttc = TextColor;      // title text color
-  tfc = HighlightColor;     // title fill color
-  ditc = MENU_C_DKGREY;
-  strncpy(ttx, TitleText, MAX_CHAR_LEN);
-  strncpy(etx, EXIT_TEXT, MAX_CHAR_LEN);
-  currentID = 1;    // id of current highlighted or selected item (1 to ID)
-  cr = 1;       // current selected row on the screen (1 to mr-1)
-  totalID = 0;    // maximum number of items (where first position is 1)
-  sr = 0;       // draw offset for the menu array where first postion is 0
-  pr = 1;       // previous selected rown (1 to mr - 1)
-  rowselected = false;
-  enablestate[0] = true;
-  radius = 0;
-  thick = 0;
-}
-
-void EditMenu::setInitialItem(int ItemID){
-	
-	// not taking into account if the first item is disabled
-	if (ItemID > totalID) {
-		ItemID = 0;
-	}
-	
-	currentID = ItemID;  
-	cr = ItemID; 
-	
-}
-
-
-int EditMenu::addNI(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
-                    byte DecimalPlaces, const char **ItemMenuText) {
-
-  totalID++;
-  strcpy(itemlabel[totalID], ItemText);
-  low[totalID] = LowLimit;
-  high[totalID] = HighLimit;
-  inc[totalID] = Increment;
-  dec[totalID] = DecimalPlaces;
-  haslist[totalID] = false;
-  value[totalID] = Data;
-
-  if (ItemMenuText) {
-    haslist[totalID] = true;
-    itemtext[totalID] = (char **) ItemMenuText;
-  }
-
-  IconType[totalID] = ICON_NONE;
-
-  enablestate[totalID] = true;
-  return (totalID);
-
-}
-int EditMenu::addMono(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
-                      byte DecimalPlaces, const char **ItemMenuText,
-                      const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
-
-  totalID++;
-  strcpy(itemlabel[totalID], ItemText);
-  low[totalID] = LowLimit;
-  high[totalID] = HighLimit;
-  inc[totalID] = Increment;
-  dec[totalID] = DecimalPlaces;
-  haslist[totalID] = false;
-  value[totalID] = Data;
-
-  if (ItemMenuText) {
-    haslist[totalID] = true;
-    itemtext[totalID] = (char **) ItemMenuText;
-  }
-
-  itemBitmap[totalID] = (unsigned char*) Bitmap;
-  bmp_w[totalID] = BitmapWidth;
-  bmp_h[totalID] = BitmapHeight;
-  IconType[totalID] = ICON_MONO;
-
-  enablestate[totalID] = true;
-  return (totalID);
-
-}
-
-int EditMenu::add565(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
-                     byte DecimalPlaces, const char **ItemMenuText,
-                     const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
-
-  totalID++;
-  strcpy(itemlabel[totalID], ItemText);
-  low[totalID] = LowLimit;
-  high[totalID] = HighLimit;
-  inc[totalID] = Increment;
-  dec[totalID] = DecimalPlaces;
-  haslist[totalID] = false;
-  value[totalID] = Data;
-
-  if (ItemMenuText) {
-    haslist[totalID] = true;
-    itemtext[totalID] = (char **) ItemMenuText;
-  }
-
-  item565Bitmap[totalID] = (uint16_t* ) Bitmap;
-  bmp_w[totalID] = BitmapWidth;
-  bmp_h[totalID] = BitmapHeight;
-  IconType[totalID] = ICON_565;
-
-  enablestate[totalID] = true;
-  return (totalID);
-
-}
-
-int EditMenu::selectRow() {
-
-  if (currentID == 0) {
-    // trigger to exit out of the menu
-    item = 0;
-    return 0;
-  }
-  // otherwise this is the trigger to enable editing in the row
-
-  rowselected = !rowselected;
-
-  drawRow(currentID);
-  item = currentID;
-  return currentID;
-
-}
-
-
-void EditMenu::drawHeader(bool hl, uint8_t style) {
-
-  d->setFont(titlef);
-
-  if (enabletouch) {
-
-    if (style == BUTTON_PRESSED) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-    else {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-
-    if (totalID > imr) {
-      // up arrow
-      d->fillTriangle( tbl +  25 + 15 , tbt + tbh - 10, // bottom left
-                       tbl +  25 - 15 , tbt + tbh - 10, // bottom right
-                       tbl +  25    , tbt + 10, //center
-                       ttc);
-      // down arrow
-      d->fillTriangle( tbw -  25 + 15 , tbt + 10, // top left
-                       tbw -  25 - 15 , tbt + 10, // top right
-                       tbw -  25    , tbt + tbh - 10, //center
-                       ttc);
-    }
-
-  }
-  else {
-    if (hl) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ihtc);
-      d->print(etx);
-
-      d->fillTriangle( tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) - 3,
-                       tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) - (tbh / 3.0),
-                       tbw - 5,       tbt + (tbh / 2.0) - 3,
-                       ihtc);
-
-      d->fillTriangle( tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) + 3,
-                       tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) + (tbh / 3.0),
-                       tbw - 5,       tbt + (tbh / 2.0) + 3,
-                       ihtc);
-    }
-
-    else {
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-  }
-
-
-
-}
-
-int EditMenu::press(int16_t ScreenX, int16_t ScreenY) {
-
-  int bs;
-
-
-  // check if header pressed
-  if (  (ScreenX > tbl) && (ScreenX < (tbw + tbl))  &&  (ScreenY > tbt ) && (ScreenY < (tbt + tbh) )) {
-
-    if (ScreenX < (tbl + 25 + 15)) {
-      // up arrow
-      MoveDown();
-      return -1;
-    }
-
-    if (ScreenX > (tbw - 25 - 15)) {
-      // down arrow
-      MoveUp();
-      return -1;
-    }
-
-    // above will allow arrow up down but
-    // let's not allow menu exit until they are done editing the line item
-    if (rowselected) {
-      return - 1;
-    }
-    // not up / down and nothing selected, allow menu exit
-    return 0;
-  }
-
-  for (i = 1; i <= imr; i++) {
-    bs = icox + bmp_w[i + sr] + isx;
-    itx = bs + iox;
-
-    if (
-      (ScreenX > bs) &&
-      (ScreenY > (isy + (irh * (i - 1)))) &&
-      (ScreenX < (irw)) &&
-      (ScreenY < (isy + irh + (irh * (i - 1))))
-    ) {
-      if (!enablestate[i + sr]) {
-        return -1;
-      }
-      delay(100);
-      if (rowselected) {
-        if (i == cr) {
-          rowselected = !rowselected;
-          item = i + sr;
-          cr = i;
-          currentID = i + sr;
-          //drawRow(currentID);
-          return currentID;
-        }
-      }
-      else {
-        rowselected = !rowselected;
-        currentID = i + sr;
-        cr = i;
-        //drawRow(currentID);
-        return currentID;
-      }
-    }
-
-  }
-  return -1;
-}
-
-void EditMenu::up() {
-  cr--;
-  currentID--;
-  drawItems();
-  if (enablestate[currentID] == false) {
-    while (enablestate[currentID] == false) {
-      cr--;
-      currentID--;
-      drawItems();
-    }
-  }
-}
-
-void EditMenu::down() {
-
-  cr++;
-  currentID++;
-  drawItems();
-  if (enablestate[currentID] == false) {
-    while (enablestate[currentID] == false) {
-      cr++;
-      currentID++;
-      drawItems();
-    }
-  }
-}
-
-
-void EditMenu::MoveUp() {
-
-  if (rowselected) {
-    incrementUp();
-  }
-  else {
-    up();
-  }
-
-}
-
-void EditMenu::MoveDown() {
-
-  if (rowselected) {
-    incrementDown();
-  }
-  else {
-    down();
-  }
-}
-
-
-
-void EditMenu::draw() {
-  drawHeader(false, 0);
-  drawItems();
-}
-
-void EditMenu::drawItems() {
-
-  int  bs;
-
-  if (imr > totalID) {
-    imr = totalID;
-  }
-  redraw = false;
-  // determine if we need to pan or just increment the list
-
-  if ((currentID >  totalID) && (sr >= 0) ) {
-    // up to top
-    cr = 0;
-    currentID = 0;
-    sr = 0;
-    redraw = true;
-  }
-  else if ( (cr < 0) && (sr == 0) ) {
-    //  pan whole menu to bottom
-    cr = imr;
-    currentID = totalID;
-    sr = totalID - imr;
-    redraw = true;
-  }
-  else if ( (cr > imr) && ((sr + cr) > totalID) ) {
-    //  pan whole menu to top
-    cr = 1;
-    currentID = 1;
-    sr = 0;
-    redraw = true;
-  }
-  else if ((cr > imr) && (sr >= 0))   {
-    // scroll whole list up one by one
-    sr++;
-    cr = imr;
-    redraw = true;
-  }
-  else if ((cr < 1) && (sr > 0))   {
-    // scroll whole list down one by one
-    sr--;
-    cr = 1;
-    redraw = true;
-  }
-
-  // determine if we need arrows
-  if (cr == imr) {
-    moredown = true;
-  }
-  if (cr == 1) {
-    moreup = true;
-  }
-
-  if (enablestate[currentID] == false) {
-    return;
-  }
-
-  // determine if we need to redraw the header and draw
-  if ((currentID == 0) && (cr == 0)) {
-    drawHeader(true, 0);
-    redrawh = true;
-  }
-  else if ((pr == 0) && (cr > 0)) {
-    if (redrawh) {
-      redrawh = false;
-      drawHeader(false, 0);
-    }
-  }
-
-  d->setFont(itemf);
-
-  // now draw the items in the rows
-  for (i = 1; i <= imr; i++) {
-    // menu bar start
-    bs = icox + bmp_w[i + sr] + isx;
-
-    // text start
-    itx = bs + iox;
-
-    if (enablestate[i + sr]) {
-      temptColor = itc;
-    }
-    else {
-      temptColor = ditc;
-    }
-
-    if (redraw) {
-      // scroll so blank out every row including icon since row will get scrolled
-      d->fillRect(bs, isy - irh + (irh * i), irw - bs, irh, ibc); // back color
-    }
-
-    if (i == pr) {
-      // maybe just row change so blank previous
-      d->fillRect(bs, isy - irh + (irh * pr) , irw - bs, irh, ibc); // back color
-    }
-
-    if ((i == cr) && (!enabletouch)) {
-
-      if (radius > 0) {
-        d->fillRoundRect(bs,      isy - irh + (irh * i) ,      irw - bs,       irh,        radius,   bcolor);
-        d->fillRoundRect(bs + thick,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
-      }
-      else {
-        d->fillRect(bs,       isy - irh + (irh * i) ,      irw - bs  ,        irh, bcolor);
-        d->fillRect(bs + thick ,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
-      }
-
-      if (moreup) {
-        d->fillTriangle(irw - 8 - thick,              isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
-                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + (irh / TRIANGLE_H),
-                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + irh - (irh / TRIANGLE_H), ihtc);
-      }
-      if (moredown) {
-        d->fillTriangle(irw - 8 - thick,                 isy - irh + (irh * i) + (irh / TRIANGLE_H),
-                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
-                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + (irh / TRIANGLE_H),     ihtc);
-      }
-      temptColor = ihtc;
-
-    }
-
-    // write bitmap
-
-    if (IconType[i + sr] == ICON_MONO) {
-      drawMonoBitmap(icox,  icoy + isy - irh + (irh * i), itemBitmap[i + sr], bmp_w[i + sr], bmp_h[i + sr], itc );
-    }
-    else if (IconType[i + sr] == ICON_565) {
-      draw565Bitmap(icox,  icoy + isy - irh + (irh * i), item565Bitmap[i + sr], bmp_w[i + sr], bmp_h[i + sr] );
-    }
-
-    // write text
-    d->setTextColor(temptColor);
-    d->setCursor(itx , isy - irh + (irh * i) + ioy);
-    d->print(itemlabel[i + sr]);
-
-    // write new val
-    d->setCursor(col , isy - irh + (irh * i) + ioy);
-    if (haslist[i + sr]) {
-      d->print(itemtext[i + sr][(int) value[i + sr]]);
-    }
-    else {
-      d->print(value[i + sr], dec[i + sr]);
-    }
-
-  }
-
-  moreup = false;
-  moredown = false;
-  pr = cr;
-
-}
-
-void EditMenu::drawRow(int ID) {
-
-  int  bs;
-  int hr = ID - sr;
-  bool drawarrow = false;
-
-  uint16_t textcolor, backcolor, sbackcolor;
-
-  moredown = false;
-  moreup = false;
-
-  // compute starting place for text
-  itx = isx + icox +  bmp_w[ID];
-  textcolor = itc;
-
-  if (ID == 0) {
-    drawHeader(false, rowselected);
-  }
-
-  if (ID <= 0) {
-    return;
-  }
-
-  bs = icox + bmp_w[hr] + isx;
-
-  if (ID <= sr) {
-    // item is off screen
-    return;
-  }
-
-  if (ID > (sr + imr)) {
-    // item is off screen
-    return;
-  }
-
-  if (enabletouch) {
-
-    if (ID == currentID) {
-      if (!rowselected) {
-        textcolor = itc;
-        backcolor = ibc;
-	    sbackcolor = ibc;
-      }
-      else {
-        // case draw row is the selected row
-        textcolor = istc;
-        backcolor = isbc;
-	    sbackcolor = sbcolor;
-      }
-    }
-    else {
-      // case draw row is not the selected row
-      textcolor = itc;
-      backcolor = ibc;
-      sbackcolor = ibc;
-    }
-
-  }
-  else {
-    if ((cr + sr) == ID) {
-
-      if (!rowselected) {
-        // case 1 draw som is draw row AND highlighted
-        textcolor = ihtc;
-        backcolor = ihbc;
-	sbackcolor = ibc;
-        drawarrow = true;
-
-      }
-      else if (rowselected) {
-        // case 2 = current row is draw row AND highlighted
-        textcolor = istc;
-        backcolor = isbc;
-	sbackcolor = bcolor;
-        drawarrow = false;
-
-      }
-    }
-    else  {
-      // current row is not selected
-      if (enablestate[ID]) {
-        textcolor = itc;
-      }
-      else {
-        textcolor = ditc;
-      }
-      backcolor = ibc;
-      sbackcolor = ibc;
-      drawarrow = true;
-    }
-  }
-
-  if ((cr == 5) && (!rowselected)) {
-    moredown = true;
-  }
-  else if ((cr == 1) && (!rowselected)) {
-    moreup = true;
-  }
-  else if (cr == 0) {
-    moredown = true;
-    moreup = true;
-  }
-
-  if (enabletouch) {
-    drawarrow = false;
-  }
-
-  if (ID == 0) {
-    if (rowselected) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-    else {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-  }
-  else {
-
-    if (!enabletouch) {
-      // non touch
-      if (radius > 0) {
-        d->fillRoundRect(bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   sbackcolor);
-        d->fillRoundRect(bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   backcolor);
-      }
-      else {
-        d->fillRect(bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, sbackcolor);
-	d->fillRect(bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  backcolor);
-      }
-    }
-
-    else {
-      // touch
-      if (rowselected) {
-
-        if (radius > 0) {
-          d->fillRoundRect(bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   sbackcolor);
-          d->fillRoundRect(bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   backcolor);
-        }
-        else {
-          d->fillRect(bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, sbackcolor);
-	  d->fillRect(bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  backcolor);
-        }
-
-      }
-      else {
-
-        d->fillRect(bs, isy - irh + (irh * hr) , irw - bs, irh, ibc); // back color
-
-      }
-    }
-    if (!enablestate[ID]) {
-      textcolor = ditc;
-    }
-    // write text
-    itx = bs + iox;
-    d->setFont(itemf);
-    d->setTextColor(textcolor);
-    d->setCursor(itx , isy - irh + (irh * hr) + ioy);
-    d->print(itemlabel[ID]);
-
-    d->setCursor(col , isy - irh + (irh * (ID - sr)) + ioy);
-    if (haslist[ID]) {
-      d->print(itemtext[ID][(int) value[ID]]);
-    }
-    else {
-      d->print(value[ID], dec[ID]);
-    }
-
-    // write bitmap
-    if (IconType[ID] == ICON_MONO) {
-      drawMonoBitmap(icox,  icoy + isy - irh + (irh * (ID - sr)), itemBitmap[ID], bmp_w[ID], bmp_h[ID], temptColor );
-    }
-    else if (IconType[ID] == ICON_565) {
-      draw565Bitmap(icox,  icoy + isy - irh + (irh * (ID - sr)), item565Bitmap[ID], bmp_w[ID], bmp_h[ID] );
-    }
-
-    if (drawarrow) {
-      if (moreup) {
-        d->fillTriangle(  irw - 2 - (2 * thick),             isy + (irh * cr) - irh + irh - (irh / TRIANGLE_H),
-                          irw - ((irh / TRIANGLE_W)*.5) - 2 - (2 * thick),  isy - irh + (irh * cr) + (irh / TRIANGLE_H),
-                          irw - (irh / TRIANGLE_W) - 2 - (2 * thick),   isy - irh + (irh * cr) + irh - (irh / TRIANGLE_H),
-                          ihtc);
-      }
-      else if (moredown) {
-        d->fillTriangle(  irw - 2 - (2 * thick),              isy - irh + (irh * cr) + (irh / TRIANGLE_H),
-                          irw - ((irh / TRIANGLE_W)*.5) - 2 - (2 * thick),  isy - irh + (irh * cr) + irh - (irh / TRIANGLE_H),
-                          irw - (irh / TRIANGLE_W) - 2 - (2 * thick),   isy - irh + (irh * cr) + (irh / TRIANGLE_H),
-                          ihtc);
-      }
-    }
-
-  }
-}
-
-void EditMenu::setIncrementDelay(uint16_t Delay) {
-
-  incdelay = Delay;
-
-}
-
-void EditMenu::incrementUp() {
-
-  d->setFont(itemf);
-  d->setTextColor(istc);
-
-
-  if (haslist[currentID]) {
-
-    if ((value[currentID] + inc[currentID]) < high[currentID]) {
-      value[currentID] += inc[currentID];
-      d->fillRect(col, isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-      d->setCursor(col + iox , isy - irh + (irh * cr) + ioy);
-      d->print(itemtext[currentID][(int) value[currentID]]);
-    }
-    else {
-      value[currentID] = low[currentID];
-      d->fillRect(col, isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-      d->setCursor(col, isy - irh + (irh * cr) + ioy);
-      d->print(itemtext[currentID][(int) value[currentID]]);
-    }
-
-  }
-  else {
-
-    value[currentID] += inc[currentID];
-    if (value[currentID] > high[currentID]) {
-      value[currentID] = low[currentID];
-    }
-    d->fillRect(col, isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-    d->setCursor(col +  iox, isy - irh + (irh * cr) + ioy);
-    d->print(value[currentID], dec[currentID]);
-  }
-
-  if (IconType[currentID] == ICON_MONO) {
-    drawMonoBitmap(icox,  icoy + isy - irh + (irh * cr), itemBitmap[currentID], bmp_w[currentID], bmp_h[currentID], temptColor );
-  }
-  else if (IconType[currentID] == ICON_565) {
-    draw565Bitmap(icox,  icoy + isy - irh + (irh * cr), item565Bitmap[currentID], bmp_w[currentID], bmp_h[currentID] );
-  }
-  delay(incdelay);
-  value[currentID] = value[currentID];
-  item = currentID;
-}
-
-
-
-
-void EditMenu::incrementDown() {
-
-  d->setFont(itemf);
-  d->setTextColor(istc);
-  if (haslist[currentID]) {
-    if ((value[currentID] - inc[currentID]) >= low[currentID]) {
-      value[currentID] -= inc[currentID];
-      d->fillRect(col , isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-      d->setCursor(col , isy - irh + (irh * cr) + ioy);
-      d->print(itemtext[currentID][(int) value[currentID]]);
-    }
-    else {
-      value[currentID] = high[currentID] - 1;
-      d->fillRect(col , isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-      d->setCursor(col, isy - irh + (irh * cr) + ioy);
-      d->print(itemtext[currentID][(int) value[currentID]]);
-    }
-  }
-  else {
-    value[currentID] -= inc[currentID];
-    if (value[currentID] < low[currentID]) {
-      value[currentID] = high[currentID];
-    }
-    d->fillRect(col, isy - irh + (irh * cr) + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
-    d->setCursor(col , isy - irh + (irh * cr) + ioy);
-    d->print(value[currentID], dec[currentID]);
-  }
-
-  if (IconType[currentID] == ICON_MONO) {
-    drawMonoBitmap(icox,  icoy + isy  - irh + (irh * cr), itemBitmap[currentID], bmp_w[currentID], bmp_h[currentID], temptColor );
-  }
-  else if (IconType[currentID] == ICON_565) {
-    draw565Bitmap(icox,  icoy + isy  - irh + (irh * cr), item565Bitmap[currentID], bmp_w[currentID], bmp_h[currentID] );
-  }
-  delay(incdelay);
-  item = currentID;
-
-}
-
-void EditMenu::setTitleColors( uint16_t TitleTextColor, uint16_t TitleFillColor) {
-  ttc = TitleTextColor;
-  tfc = TitleFillColor;
-}
-
-void EditMenu::setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight) {
-  tbt = TitleTop;
-  tbl = TitleLeft;
-  tbw = TitleWith;
-  tbh = TitleHeight;
-}
-
-void EditMenu::setTitleText( char *TitleText,  char *ExitText) {
-  strncpy(ttx, TitleText, MAX_CHAR_LEN);
-  strncpy(etx, ExitText, MAX_CHAR_LEN);
-}
-
-void EditMenu::setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin) {
-  tox = LeftMargin; // pixels to offset text in menu bar
-  toy = TopMargin;  // pixels to offset text in menu bar
-}
-
-
-void EditMenu::setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, uint16_t BorderRadius, uint16_t BorderThickness) {
-  isx = LeftMargin;  // pixels to offset text in menu bar
-  irw = Width - isx;  // pixels to offset text in menu bar
-  radius = BorderRadius;
-  thick = BorderThickness;
-}
-
-void EditMenu::setItemColors( uint16_t DisableTextColor, uint16_t HighlightBorderColor, uint16_t SelectBorderColor) {
-  ditc = DisableTextColor;
-  bcolor = HighlightBorderColor;
-  sbcolor = SelectBorderColor;
-}
-
-void EditMenu::SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, 
-							uint16_t HighlightTextColor, uint16_t HighlightColor, uint16_t HighlightBorderColor,
-							uint16_t SelectedTextColor, uint16_t SelectedColor, uint16_t SelectBorderColor,
-							uint16_t DisableTextColor ,	uint16_t TitleTextColor, uint16_t TitleFillColor){
-
-	itc = TextColor;
-	ibc = BackgroundColor;
-	ihtc = HighlightTextColor;
-	ihbc = HighlightColor;
-	bcolor = HighlightBorderColor;
-	istc = SelectedTextColor;
-	isbc = SelectedColor;
-	sbcolor = SelectBorderColor;
-	ttc = TitleTextColor;
-	tfc = TitleFillColor;
-	ditc = DisableTextColor;
-	
-	}
-
-void EditMenu::setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin) {
-  iox = LeftMargin;  // pixels to offset text in menu bar
-  ioy = TopMargin;  // pixels to offset text in menu bar
-  mm = MenuMargin;
-  isy = tbt + tbh + mm;
-}
-
-void EditMenu::setItemText(int ID, const char *ItemText) {
-  strcpy(itemlabel[ID], ItemText);
-  drawRow(ID);
-}
-
-void EditMenu::setIconMargins(uint16_t LeftMargin, uint16_t TopMargin) {
-  icox = LeftMargin; // pixels to offset text in menu bar
-  icoy = TopMargin;  // pixels to offset text in menu bar
-}
-
-
-void EditMenu::disable(int ID) {
-  enablestate[ID] = false;
-}
-
-void EditMenu::enable(int ID) {
-  enablestate[ID] = true;
-}
-
-bool EditMenu::getEnableState(int ID) {
-  return enablestate[ID];
-}
-
-void EditMenu::SetItemValue(int ID, float ItemValue) {
-  value[ID] = ItemValue;
-}
-
-void EditMenu::drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color) {
-
-  uint8_t sbyte = 0;
-  uint8_t byteWidth = 0;
-  int jj, ii;
-
-  byteWidth = (w + 7) / 8;
-
-  for (jj = 0; jj < h; jj++) {
-    for (ii = 0; ii < w; ii++) {
-      if (ii & 7)  sbyte <<= 1;
-      else sbyte   = pgm_read_byte(bitmap + jj * byteWidth + ii / 8);
-      if (sbyte & 0x80) d->drawPixel(x + ii, y + jj, color);
-    }
-  }
-
-}
-
-void EditMenu::draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h) {
-
-  uint32_t offset = 0;
-
-  int j, i;
-
-  for (i = 0; i < h; i++) {
-    for (j = 0; j < w; j++) {
-      d->drawPixel(j + x, i + y, pgm_read_word_near(bitmap + offset));
-      offset++;
-    }
-  }
-
-}
-
-/*
-
-  object type to create a simple selection only menu unlike previous where selecting a line item would allow in-line editing
-
-
-*/
-
-
-
-ItemMenu::ItemMenu(Adafruit_ST7735 *Display, bool EnableTouch) {
-  d = Display;
-  enabletouch = EnableTouch;
-}
-
-void ItemMenu::init(uint16_t TextColor, uint16_t BackgroundColor,
-                    uint16_t HighlightTextColor, uint16_t HighlightColor,
-                    uint16_t ItemRowHeight, uint16_t MaxRow,
-                    const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont) {
-
-  itc = TextColor;
-  ibc = BackgroundColor;
-  ihtc = HighlightTextColor;
-  ihbc = HighlightColor;
-  bcolor = TextColor;
-  tbt = 0;      // title bar top
-  tbl = 0;      // title bar left
-  tbh = 40;     // title bar height
-  tbw = d->width(); // title bar width, default to screen width
-  tox = 20;     // x pixel offset for title text to offset from left a bit
-  toy  = 10;        // y pixel offset for title text to manage height offset from top
-  isx = 0;      // where to start the menu item from left, default indent 10
-  icox = 0;
-  icoy = 0;
-  mm = 5;
-  isy = tbt + tbh + mm; // where to start the menu item from top, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
-  irh = ItemRowHeight;  // select bar height
-  irw = tbw - isx;    // select bar width, default to full width
-  imr = MaxRow;     // user has to indicate this
-  iox = 0;        // pixels to offset text in menu bar
-  ioy = 0;        // pixels to offset text in menu bar
-  itemf = &ItemFont;     // item font
-  titlef = &TitleFont;   // menu bar font, default to item font
-  ttc = TextColor;    // title text color
-  tfc = HighlightColor; // title fill color
-  ditc = MENU_C_DKGREY;
-  strncpy(ttx, TitleText, MAX_CHAR_LEN);
-  strncpy(etx, EXIT_TEXT, 6);
-  item = 1;
-  drawTitleFlag = true; // flag if we draw menu bar again
-  currentID = 1;    // id of current highlighted or selected item (1 to ID)
-  cr = 1;       // current selected row on the screen (1 to mr-1)
-  totalID = 0;      // maximum number of items (where first position is 1)
-  sr = 0;       // draw offset for the menu array where first postion is 0
-  pr = 1;       // previous selected rown (1 to mr - 1)
-  rowselected = false;
-  enablestate[0] = true;
-  redraw = true;
-  radius = 0;
-  thick = 0;
-
-}
-
-
-void ItemMenu::setInitialItem(int ItemID){
-	
-	// not taking into account if the first item is disabled
-	if (ItemID > totalID) {
-		ItemID = 0;
-	}
-
-	currentID = ItemID;  
-	cr = ItemID; 
-}
-
-
-int ItemMenu::addNI(const char *ItemLabel) {
-
-  totalID++;
-
-  IconType[totalID] = ICON_NONE;
-
-  enablestate[totalID] = true;
-  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
-  return (totalID);
-
-}
-
-int ItemMenu::addMono(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
-
-  totalID++;
-
-  itemBitmap[totalID] = Bitmap;
-  
-  bmp_w[totalID] = BitmapWidth;
-  bmp_h[totalID] = BitmapHeight;
-  IconType[totalID] = ICON_MONO;
-
-  enablestate[totalID] = true;
-  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
-  return (totalID);
-}
-
-int ItemMenu::add565(const char *ItemLabel, const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
-
-  totalID++;
-
-  item565Bitmap[totalID] = Bitmap;
-  bmp_w[totalID] = BitmapWidth;
-  bmp_h[totalID] = BitmapHeight;
-  IconType[totalID] = ICON_565;
-
-  enablestate[totalID] = true;
-  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
-    
-  return (totalID);
-}
-
-void ItemMenu::drawHeader(bool hl, uint8_t style) {
-
-  d->setFont(titlef);
-
-  if (enabletouch) {
-
-    if (style == BUTTON_PRESSED) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-    else {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-
-    if (totalID > imr) {
-      // up arrow
-      d->fillTriangle( tbl +  25 + 15 , tbt + tbh - 10, // bottom left
-                       tbl +  25 - 15 , tbt + tbh - 10, // bottom right
-                       tbl +  25    , tbt + 10, //center
-                       ttc);
-      // down arrow
-      d->fillTriangle( tbw -  25 + 15 , tbt + 10, // top left
-                       tbw -  25 - 15 , tbt + 10, // top right
-                       tbw -  25    , tbt + tbh - 10, //center
-                       ttc);
-    }
-
-  }
-  else {
-    if (hl) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ihtc);
-      d->print(etx);
-
-      d->fillTriangle( tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) - 3,
-                       tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) - (tbh / 3.0),
-                       tbw - 5,       tbt + (tbh / 2.0) - 3,
-                       ihtc);
-
-      d->fillTriangle( tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) + 3,
-                       tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) + (tbh / 3.0),
-                       tbw - 5,       tbt + (tbh / 2.0) + 3,
-                       ihtc);
-    }
-
-    else {
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-  }
-
-}
-
-
-
-int ItemMenu::press(int16_t ScreenX, int16_t ScreenY) {
-
-  int bs;
-
-  // check if header pressed
-  if (  (ScreenX > tbl) && (ScreenX < (tbw + tbl))  &&  (ScreenY > tbt ) && (ScreenY < (tbt + tbh) )) {
-
-    if (ScreenX < (tbl + 25 + 15)) {
-      // up arrow
-      if (cr == 1) {
-        cr = imr;
-        //sr++;
-      }
-
-      MoveDown();
-      return -1;
-    }
-
-    if (ScreenX > (tbw - 25 - 15)) {
-      // down arrow
-      if (cr <= imr) {
-        cr = 0;
-        //currentID = sr;
-      }
-      MoveUp();
-      return -1;
-    }
-
-    return 0;
-  }
-
-  for (i = 1; i <= imr; i++) {
-    bs = icox + bmp_w[i + sr] + isx;
-    itx = bs + iox;
-
-    if (
-      (ScreenX > bs) &&
-      (ScreenY > (isy + (irh * (i - 1)))) &&
-      (ScreenX < (irw)) &&
-      (ScreenY < (isy + irh + (irh * (i - 1))))
-    ) {
-    	if (!enablestate[i + sr]) {
-      		return -1;
-    	}
-
-      	return i + sr;
-    }
-  }
-  return -1;
-}
-
-void ItemMenu::drawRow(int ID, uint8_t style) {
-
-  int  bs;
-  int hr = ID - sr;
-
-  if (ID == 0) {
-    drawHeader(false, style);
-  }
-
-  if ((!enabletouch) || (ID <= 0)) {
-    return;
-  }
-
-  bs = icox + bmp_w[hr] + isx;
-
-  if (!enablestate[hr]) {
-    return;
-  }
-
-  if (ID == 0) {
-    if (style == BUTTON_PRESSED) {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, ihbc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-    else {
-      // draw new menu bar
-      d->setCursor(tbl + tox, tbt + toy);
-      d->fillRect(tbl, tbt, tbw, tbh, tfc);
-      d->setTextColor(ttc);
-      d->print(ttx);
-    }
-  }
-  else {
-
-
-    if (style == BUTTON_PRESSED) {
-
-      if (radius > 0) {
-        d->fillRoundRect(bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   bcolor);
-        d->fillRoundRect(bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
-      }
-      else {
-        d->fillRect(bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, bcolor);
-        d->fillRect(bs + thick ,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
-      }
-
-    }
-    else {
-
-      d->fillRect(bs, isy - irh + (irh * hr) , irw - bs, irh, ibc); // back color
-
-    }
-
-    // write text
-    itx = bs + iox;
-    d->setFont(itemf);
-    d->setTextColor(ihtc);
-    d->setCursor(itx , isy - irh + (irh * hr) + ioy);
-    d->print(itemlabel[ID]);
-
-  }
-
-}
-
-
-void ItemMenu::draw() {
-  drawHeader(false, 0);
-
-  drawItems();
-}
-
-void ItemMenu::drawItems() {
-
-  int  bs;
-
-  if (imr > totalID) {
-    imr = totalID;
-  }
-  redraw = false;
-  // determine if we need to pan or just increment the list
-
-  if ((currentID >  totalID) && (sr >= 0) ) {
-    // up to top
-    cr = 0;
-    currentID = 0;
-    sr = 0;
-    redraw = true;
-  }
-  else if ( (cr < 0) && (sr == 0) ) {
-    //  pan whole menu to bottom
-    cr = imr;
-    currentID = totalID;
-    sr = totalID - imr;
-    redraw = true;
-  }
-  else if ( (cr > imr) && ((sr + cr) > totalID) ) {
-    //  pan whole menu to top
-    cr = 1;
-    currentID = 1;
-    sr = 0;
-    redraw = true;
-  }
-  else if ((cr > imr) && (sr >= 0))   {
-    // scroll whole list up one by one
-    sr++;
-    cr = imr;
-    redraw = true;
-  }
-  else if ((cr < 1) && (sr > 0))   {
-    // scroll whole list down one by one
-    sr--;
-    cr = 1;
-    redraw = true;
-  }
-
-  // determine if we need arrows
-  if (cr == imr) {
-    moredown = true;
-  }
-  if (cr == 1) {
-    moreup = true;
-  }
-
-  if (enablestate[currentID] == false) {
-    return;
-  }
-
-  // determine if we need to redraw the header and draw
-  if ((currentID == 0) && (cr == 0)) {
-    drawHeader(true, 0);
-  }
-  else if ((pr == 0) && (cr > 0)) {
-    drawHeader(false, 0);
-  }
-
-  d->setFont(itemf);
-
-  // now draw the items in the rows
-  for (i = 1; i <= imr; i++) {
-    // menu bar start
-    bs = icox + bmp_w[i + sr] + isx;
-
-    // text start
-    itx = bs + iox;
-
-    if (enablestate[i + sr]) {
-      temptColor = itc;
-    }
-    else {
-      temptColor = ditc;
-    }
-
-    if (redraw) {
-      // scroll so blank out every row including icon since row will get scrolled
-      d->fillRect(bs, isy - irh + (irh * i), irw - bs, irh, ibc); // back color
-    }
-
-    if (i == pr) {
-      // maybe just row change so blank previous
-      d->fillRect(bs, isy - irh + (irh * pr) , irw - bs, irh, ibc); // back color
-    }
-
-    if ((i == cr) && (!enabletouch)) {
-
-      if (radius > 0) {
-        d->fillRoundRect(bs,      isy - irh + (irh * i) ,      irw - bs,       irh,        radius,   bcolor);
-        d->fillRoundRect(bs + thick,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
-      }
-      else {
-        d->fillRect(bs,       isy - irh + (irh * i) ,      irw - bs  ,        irh, bcolor);
-        d->fillRect(bs + thick ,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
-      }
-
-
-      if (moreup) {
-        d->fillTriangle(irw - 8 - thick,              isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
-                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + (irh / TRIANGLE_H),
-                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + irh - (irh / TRIANGLE_H), ihtc);
-      }
-      if (moredown) {
-        d->fillTriangle(irw - 8 - thick,                 isy - irh + (irh * i) + (irh / TRIANGLE_H),
-                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
-                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + (irh / TRIANGLE_H),     ihtc);
-      }
-      temptColor = ihtc;
-
-    }
-
-    // write bitmap
-
-    if (IconType[i + sr] == ICON_MONO) {
-      drawMonoBitmap(icox,  icoy + isy - irh + (irh * i), itemBitmap[i + sr], bmp_w[i + sr], bmp_h[i + sr], itc );
-    }
-    else if (IconType[i + sr] == ICON_565) {
-      draw565Bitmap(icox,  icoy + isy - irh + (irh * i), item565Bitmap[i + sr], bmp_w[i + sr], bmp_h[i + sr] );
-    }
-
-    // write text
-    d->setTextColor(temptColor);
-    d->setCursor(itx , isy - irh + (irh * i) + ioy);
-    d->print(itemlabel[i + sr]);
-  }
-
-  moreup = false;
-  moredown = false;
-  pr = cr;
-
-}
-
-void ItemMenu::MoveUp() {
-
-  cr--;
-
-  currentID--;
-
-  drawItems();
-
-  if (enablestate[currentID] == false) {
-    while (enablestate[currentID] == false) {
-      cr--;
-      currentID--;
-      drawItems();
-    }
-  }
-}
-
-void ItemMenu::MoveDown() {
-
-  cr++;
-  currentID++;
-  drawItems();
-  if (enablestate[currentID] == false) {
-    while (enablestate[currentID] == false) {
-      cr++;
-      currentID++;
-      drawItems();
-    }
-  }
-
-}
-
-int ItemMenu::selectRow() {
-  if (currentID == 0) {
-    cr = 0;
-    sr = 0;
-  }
-  item = currentID;
-  return currentID;
-}
-
-void ItemMenu::setTitleColors( uint16_t TitleTextColor, uint16_t TitleFillColor) {
-  ttc = TitleTextColor;
-  tfc = TitleFillColor;
-
-}
-
-void ItemMenu::setTitleBarSize( uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight) {
-
-  tbt = TitleTop;
-  tbl = TitleLeft;
-  tbw = TitleWith;
-  tbh = TitleHeight;
-
-}
-
-void ItemMenu::setTitleText(char *TitleText, char *ExitText) {
-  strncpy(ttx, TitleText, MAX_CHAR_LEN);
-  strncpy(etx, ExitText, MAX_CHAR_LEN);
-}
-
-void ItemMenu::setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin) {
-  tox = LeftMargin;   // pixels to offset text in menu bar
-  toy = TopMargin;   // pixels to offset text in menu bar
-}
-
-void ItemMenu::setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, byte BorderRadius, byte BorderThickness) {
-  isx = LeftMargin;  // pixels to offset text in menu bar
-  irw = Width - isx;  // pixels to offset text in menu bar
-  radius = BorderRadius;
-  thick = BorderThickness;
-
-}
-
-void ItemMenu::setItemColors(uint16_t DisableTextColor, uint16_t BorderColor) {
-  ditc = DisableTextColor;
-  bcolor = BorderColor;
-}
-
-
-void ItemMenu::SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, uint16_t HighlightTextColor, uint16_t HighlightColor, 
-		uint16_t HighLightBorderColor, uint16_t DisableTextColor, uint16_t TitleTextColor, uint16_t TitleFillColor) {
-
-	itc = TextColor;
-	ibc = BackgroundColor;
-	ihtc = HighlightTextColor;
-	ihbc = HighlightColor;
-	bcolor = HighLightBorderColor;
-	ttc = TitleTextColor;
-	tfc = TitleFillColor;
-	ditc = DisableTextColor;
-	
-	}
-
-void ItemMenu::setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin) {
-  iox = LeftMargin;  // pixels to offset text in menu bar
-  ioy = TopMargin;  // pixels to offset text in menu bar
-  mm = MenuMargin;
-  isy = tbt + tbh + mm;
-}
-
-void ItemMenu::setIconMargins(uint16_t IconOffsetX, uint16_t IconOffsetY) {
-  icox = IconOffsetX; // pixels to offset text in menu bar
-  icoy = IconOffsetY;  // pixels to offset text in menu bar
-}
-
-void ItemMenu::disable(int ID) {
-  enablestate[ID] = false;
-}
-
-void ItemMenu::enable(int ID) {
-  enablestate[ID] = true;
-}
-
-bool ItemMenu::getEnableState(int ID) {
-  return enablestate[ID];
-}
-
-
-void ItemMenu::drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color) {
-
-  uint8_t sbyte = 0;
-  uint8_t byteWidth = 0;
-  int jj, ii;
-
-  byteWidth = (w + 7) / 8;
-
-  for (jj = 0; jj < h; jj++) {
-    for (ii = 0; ii < w; ii++) {
-      if (ii & 7)  sbyte <<= 1;
-      else sbyte   = pgm_read_byte(bitmap + jj * byteWidth + ii / 8);
-      if (sbyte & 0x80) d->drawPixel(x + ii, y + jj, color);
-    }
-  }
-
-}
-
-void ItemMenu::draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h) {
-
-  uint32_t offset = 0;
-
-  int j, i;
-
-  for (i = 0; i < h; i++) {
-    for (j = 0; j < w; j++) {
-      d->drawPixel(j + x, i + y, pgm_read_word_near(bitmap + offset));
-      offset++;
-    }
-  }
-
-}
-
-/////////////////////////////////
-// end of this menu library
-/////////////////////////////////
+/*
+  The MIT License (MIT)
+
+  library writen by Kris Kasprzak
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of
+  this software and associated documentation files (the "Software"), to deal in
+  the Software without restriction, including without limitation the rights to
+  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+  the Software, and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+  On a personal note, if you develop an application or product using this library
+  and make millions of dollars, I'm happy for you!
+
+*/
+
+#include <Adafruit_ST7735_Menu.h>  
+#include "Adafruit_GFX.h"
+#include "Adafruit_ST7735.h"
+
+#if MENU_EEPROM
+#include <EEPROM.h>
+#endif
+
+// the fills of the drawing code, the profiler counts their pixels
+static inline void fill(Adafruit_GFX *G, int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+  G->fillRect(X, Y, W, H, Color);
+  MENU_PIXELS((uint32_t) W * H);
+}
+
+static inline void fillRound(Adafruit_GFX *G, int16_t X, int16_t Y, int16_t W, int16_t H, int16_t R, uint16_t Color) {
+  G->fillRoundRect(X, Y, W, H, R, Color);
+  MENU_PIXELS((uint32_t) W * H);
+}
+
+#if MENU_PROFILE
+
+static const char *profname[PROF_COUNT] = {
+  "drawHeader", "drawItems", "drawRow", "value", "increment",
+  "drawMonoBitmap", "draw565Bitmap", "drawScroll", "tick", "press",
+  "drawPacked"
+};
+
+uint32_t MenuProfiler::calls[PROF_COUNT];
+uint32_t MenuProfiler::us[PROF_COUNT];
+uint32_t MenuProfiler::pix[PROF_COUNT];
+MenuProfileFrame MenuProfiler::frame[MENU_PROFILE_FRAMES];
+uint8_t MenuProfiler::frames = 0;
+uint8_t MenuProfiler::current = 0;
+uint8_t MenuProfiler::depth = 0;
+uint32_t MenuProfiler::framepix = 0;
+
+MenuProbe::MenuProbe(uint8_t ID) {
+  id = ID;
+  parent = MenuProfiler::current;
+  MenuProfiler::current = ID;
+  if (MenuProfiler::depth == 0) {
+    MenuProfiler::framepix = 0;
+  }
+  MenuProfiler::depth++;
+  t0 = micros();
+}
+
+MenuProbe::~MenuProbe() {
+
+  uint32_t t = micros() - t0;
+
+  MenuProfiler::calls[id]++;
+  MenuProfiler::us[id] += t;
+  MenuProfiler::current = parent;
+  MenuProfiler::depth--;
+
+  if (MenuProfiler::depth == 0) {
+    MenuProfileFrame &f = MenuProfiler::frame[MenuProfiler::frames % MENU_PROFILE_FRAMES];
+    f.id = id;
+    f.us = t;
+    f.pixels = MenuProfiler::framepix;
+    MenuProfiler::frames++;
+  }
+
+}
+
+void MenuProfiler::pixels(uint32_t Count) {
+  if (depth > 0) {
+    pix[current] += Count;
+    framepix += Count;
+  }
+}
+
+void MenuProfiler::reset() {
+  memset(calls, 0, sizeof(calls));
+  memset(us, 0, sizeof(us));
+  memset(pix, 0, sizeof(pix));
+  memset(frame, 0, sizeof(frame));
+  frames = 0;
+}
+
+void MenuProfiler::dump(Print &Out) {
+
+  uint8_t i, n;
+
+  Out.println(F("function       calls us pixels bytes"));
+  for (i = 0; i < PROF_COUNT; i++) {
+    if (calls[i] == 0) {
+      continue;
+    }
+    Out.print(profname[i]);
+    for (n = strlen(profname[i]); n < 14; n++) {
+      Out.print(' ');
+    }
+    Out.print(' ');
+    Out.print(calls[i]);
+    Out.print(' ');
+    Out.print(us[i]);
+    Out.print(' ');
+    Out.print(pix[i]);
+    Out.print(' ');
+    Out.println(pix[i] * 2);
+  }
+
+  // oldest first
+  Out.println(F("last frames: function us pixels"));
+  n = (frames < MENU_PROFILE_FRAMES) ? frames : MENU_PROFILE_FRAMES;
+  for (i = 0; i < n; i++) {
+    MenuProfileFrame &f = frame[(uint8_t) (frames - n + i) % MENU_PROFILE_FRAMES];
+    Out.print(profname[f.id]);
+    Out.print(' ');
+    Out.print(f.us);
+    Out.print(' ');
+    Out.println(f.pixels);
+  }
+
+}
+
+#endif
+
+void MenuStore::read(uint32_t Address, uint8_t *Data, uint16_t Count) {
+  while (Count--) {
+    *Data++ = read(Address++);
+  }
+}
+
+void MenuStore::write(uint32_t Address, const uint8_t *Data, uint16_t Count) {
+  while (Count--) {
+    write(Address++, *Data++);
+  }
+}
+
+#if MENU_EEPROM
+
+uint8_t MenuEEPROMStore::read(uint32_t Address) {
+  return EEPROM.read(Address);
+}
+
+void MenuEEPROMStore::write(uint32_t Address, uint8_t Data) {
+  // don't wear a cell to write what's already there
+  if (EEPROM.read(Address) != Data) {
+    EEPROM.write(Address, Data);
+  }
+}
+
+void MenuEEPROMStore::commit() {
+#if defined(ESP32) || defined(ESP8266)
+  EEPROM.commit();
+#endif
+}
+
+#endif
+
+#ifndef ARDUINO
+
+MenuFileStore::MenuFileStore(const char *Path, uint32_t Size) {
+
+  long len;
+
+  f = fopen(Path, "r+b");
+  if (!f) {
+    f = fopen(Path, "w+b");
+  }
+  if (!f) {
+    return;
+  }
+
+  // new or short files read as erased EEPROM
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  while ((uint32_t) len < Size) {
+    fputc(0xFF, f);
+    len++;
+  }
+  fflush(f);
+
+}
+
+MenuFileStore::~MenuFileStore() {
+  if (f) {
+    fclose(f);
+  }
+}
+
+uint8_t MenuFileStore::read(uint32_t Address) {
+  if ((!f) || (fseek(f, Address, SEEK_SET) != 0)) {
+    return 0xFF;
+  }
+  return fgetc(f);
+}
+
+void MenuFileStore::write(uint32_t Address, uint8_t Data) {
+  if ((f) && (fseek(f, Address, SEEK_SET) == 0)) {
+    fputc(Data, f);
+  }
+}
+
+void MenuFileStore::commit() {
+  if (f) {
+    fflush(f);
+  }
+}
+
+#endif
+
+// crc-8, polynomial 0x31
+static uint8_t crc8(const uint8_t *data, uint8_t len) {
+
+  uint8_t crc = 0xFF;
+  uint8_t b;
+
+  while (len--) {
+    crc ^= *data++;
+    for (b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+  }
+  return crc;
+
+}
+
+void MenuScroll::press(int16_t ScreenY, int32_t Position, int32_t Limit, int32_t Low) {
+
+  y0 = ScreenY;
+  ly = ScreenY;
+  lt = millis();
+  p0 = Position;
+  pos = Position;
+  fpos = Position;
+  limit = Limit;
+  low = Low;
+  vel = 0;
+  dragging = false;
+  flinging = false;
+
+}
+
+bool MenuScroll::move(int16_t ScreenY) {
+
+  uint32_t now = millis();
+  int32_t np;
+
+  if (!dragging) {
+    if (abs(ScreenY - y0) < threshold) {
+      return false;
+    }
+    dragging = true;
+  }
+
+  // moving the finger up moves further down the list
+  if (now > lt) {
+    vel = (vel + ((float) (ly - ScreenY) / (now - lt))) / 2.0;
+    lt = now;
+  }
+  ly = ScreenY;
+
+  np = constrain(p0 + (y0 - ScreenY), low, limit);
+  fpos = np;
+  if (np == pos) {
+    return false;
+  }
+  pos = np;
+  return true;
+
+}
+
+bool MenuScroll::release() {
+
+  if (!dragging) {
+    return false;
+  }
+  dragging = false;
+
+  // only flick if the finger was still moving when it came off
+  if (((millis() - lt) < 100) && (fabs(vel) > 0.1)) {
+    flinging = true;
+    lt = millis();
+  }
+  return true;
+
+}
+
+bool MenuScroll::step() {
+
+  uint32_t now = millis();
+  int32_t np;
+  float dv;
+
+  if ((!flinging) || (now == lt)) {
+    return false;
+  }
+
+  fpos += vel * (now - lt);
+  dv = (decel / 1000000.0) * (now - lt);
+  lt = now;
+
+  if (vel > 0) {
+    vel = (vel > dv) ? vel - dv : 0;
+  }
+  else {
+    vel = (-vel > dv) ? vel + dv : 0;
+  }
+
+  if ((fpos <= low) || (fpos >= limit)) {
+    fpos = constrain(fpos, low, limit);
+    vel = 0;
+  }
+  if (vel == 0) {
+    flinging = false;
+  }
+
+  np = fpos;
+  if (np == pos) {
+    return false;
+  }
+  pos = np;
+  return true;
+
+}
+
+void MenuFrames::setRate(uint8_t FramesPerSecond) {
+  period = (FramesPerSecond > 0) ? 1000000UL / FramesPerSecond : 0;
+  pending = false;
+}
+
+void MenuFrames::request() {
+
+  requests++;
+  if (pending) {
+    // already waiting on a frame, this change goes out with it
+    dropped++;
+    return;
+  }
+  pending = true;
+  first = micros();
+
+}
+
+bool MenuFrames::due() {
+  return pending && ((micros() - last) >= period);
+}
+
+void MenuFrames::drawn() {
+
+  uint32_t now = micros();
+  uint32_t wait = now - first;
+
+  frames++;
+  latency += wait;
+  if (wait > maxlatency) {
+    maxlatency = wait;
+  }
+  if (wait > period) {
+    late++;
+  }
+  last = now;
+  pending = false;
+
+}
+
+void MenuFrames::reset() {
+  requests = 0;
+  frames = 0;
+  dropped = 0;
+  late = 0;
+  latency = 0;
+  maxlatency = 0;
+}
+
+MenuCanvas::MenuCanvas(Adafruit_ST7735 *Display, uint8_t Tile) : GFXcanvas16(Display->width(), Display->height()) {
+  d = Display;
+  ts = max(Tile, (uint8_t) 4);
+  cols = (width() + ts - 1) / ts;
+  rows = (height() + ts - 1) / ts;
+  tiles = cols * rows;
+  marks = new uint8_t[(tiles + 7) / 8]();
+  sum = new uint32_t[tiles]();
+}
+
+MenuCanvas::~MenuCanvas() {
+  delete [] marks;
+  delete [] sum;
+}
+
+void MenuCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+
+  uint16_t t;
+
+  if ((x < 0) || (y < 0) || (x >= width()) || (y >= height())) {
+    return;
+  }
+  t = (y / ts) * cols + (x / ts);
+  marks[t >> 3] |= 1 << (t & 7);
+  GFXcanvas16::drawPixel(x, y, color);
+
+}
+
+void MenuCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  mark(x, y, w, 1);
+  GFXcanvas16::drawFastHLine(x, y, w, color);
+}
+
+void MenuCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  mark(x, y, 1, h);
+  GFXcanvas16::drawFastVLine(x, y, h, color);
+}
+
+void MenuCanvas::fillScreen(uint16_t color) {
+  mark(0, 0, width(), height());
+  GFXcanvas16::fillScreen(color);
+}
+
+// the next flush sends every tile, for when the panel was drawn on directly or reset
+void MenuCanvas::invalidate() {
+  all = true;
+}
+
+void MenuCanvas::mark(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  int16_t c0, c1, r0, r1, c, r;
+  uint16_t t;
+
+  if ((W <= 0) || (H <= 0) || (X + W <= 0) || (Y + H <= 0) || (X >= width()) || (Y >= height())) {
+    return;
+  }
+  c0 = max(X, (int16_t) 0) / ts;
+  r0 = max(Y, (int16_t) 0) / ts;
+  c1 = (min((int16_t) (X + W), width()) - 1) / ts;
+  r1 = (min((int16_t) (Y + H), height()) - 1) / ts;
+  for (r = r0; r <= r1; r++) {
+    for (c = c0; c <= c1; c++) {
+      t = r * cols + c;
+      marks[t >> 3] |= 1 << (t & 7);
+    }
+  }
+
+}
+
+// returns once the panel shows everything flushed, call it before talking to the panel yourself
+// when there is a pipeline, without one flush has already sent it all
+void MenuCanvas::drain() {
+#if MENU_PIPELINE
+  if (pipe) {
+    pipe->drain();
+  }
+#endif
+}
+
+#if MENU_PIPELINE
+
+// flush queues its windows on Pipeline from now on, until it is begun flush sends them itself
+void MenuCanvas::setPipeline(MenuPipeline *Pipeline) {
+  pipe = Pipeline;
+}
+
+MenuPipeline::MenuPipeline(Adafruit_ST7735 *Display, MenuThread *Thread) : head(0), tail(0), running(false) {
+  d = Display;
+  th = Thread;
+}
+
+MenuPipeline::~MenuPipeline() {
+  if (running) {
+    drain();
+    running = false;
+    th->signal();
+    th->join();
+  }
+}
+
+// starts the renderer, call it from setup and not from a constructor
+bool MenuPipeline::begin() {
+  if (running) {
+    return true;
+  }
+  running = true;
+  if (!th->start(run, this)) {
+    running = false;
+  }
+  return running;
+}
+
+// queues the W x H window at X, Y, Pixels is its top left corner in a frame Stride pixels wide,
+// a window bigger than a slot goes as bands of whole rows. false if nothing was queued, the
+// renderer is not running or a row is wider than a slot, then the caller sends it itself
+bool MenuPipeline::push(const uint16_t *Pixels, int16_t Stride, int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  int16_t rows = (W > 0) ? MENU_QUEUE_PIXELS / W : 0;
+  int16_t n, j;
+  uint32_t h, t0;
+  Slot *s;
+
+  if (!running) {
+    return false;
+  }
+  if (rows < 1) {
+    // the panel is the caller's once the queue is empty
+    drain();
+    return false;
+  }
+
+  while (H > 0) {
+    n = min(H, rows);
+    h = head.load(std::memory_order_relaxed);
+    if ((h - tail.load(std::memory_order_acquire)) >= MENU_QUEUE) {
+      // backpressure, the renderer is a queue behind
+      stalls++;
+      t0 = micros();
+      while ((h - tail.load(std::memory_order_acquire)) >= MENU_QUEUE) {
+        th->yield();
+      }
+      stallus += micros() - t0;
+    }
+    s = &q[h % MENU_QUEUE];
+    s->x = X;
+    s->y = Y;
+    s->w = W;
+    s->h = n;
+    for (j = 0; j < n; j++) {
+      memcpy(s->px + (j * W), Pixels + (j * Stride), W * sizeof(uint16_t));
+    }
+    head.store(h + 1, std::memory_order_release);
+    th->signal();
+    pushed++;
+    Pixels += n * Stride;
+    Y += n;
+    H -= n;
+  }
+  return true;
+
+}
+
+// waits until the renderer has sent everything queued
+void MenuPipeline::drain() {
+  while (running && (tail.load(std::memory_order_acquire) != head.load(std::memory_order_relaxed))) {
+    th->yield();
+  }
+}
+
+// the renderer, sends windows until the pipeline is destroyed
+void MenuPipeline::run(void *Arg) {
+
+  MenuPipeline *p = (MenuPipeline *) Arg;
+  uint32_t t;
+  Slot *s;
+
+  while (p->running) {
+    t = p->tail.load(std::memory_order_relaxed);
+    if (t == p->head.load(std::memory_order_acquire)) {
+      p->th->wait();
+      continue;
+    }
+    s = &p->q[t % MENU_QUEUE];
+    p->d->startWrite();
+    p->d->setAddrWindow(s->x, s->y, s->w, s->h);
+    p->d->writePixels(s->px, (uint32_t) s->w * s->h);
+    p->d->endWrite();
+    p->tail.store(t + 1, std::memory_order_release);
+  }
+
+}
+
+#if defined(ESP32)
+
+MenuRTOSThread::MenuRTOSThread(uint8_t Core, uint8_t Priority, uint16_t Stack) {
+  core = Core;
+  priority = Priority;
+  stack = Stack;
+}
+
+bool MenuRTOSThread::start(void (*Run)(void *Arg), void *Arg) {
+  run = Run;
+  arg = Arg;
+  done = false;
+  if (xTaskCreatePinnedToCore(task, "menu", stack, this, priority, &handle, core) != pdPASS) {
+    done = true;
+    return false;
+  }
+  return true;
+}
+
+// a task must not return, it deletes itself when Run does
+void MenuRTOSThread::task(void *Self) {
+  MenuRTOSThread *t = (MenuRTOSThread *) Self;
+  t->run(t->arg);
+  t->done = true;
+  vTaskDelete(NULL);
+}
+
+void MenuRTOSThread::wait() {
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+}
+
+void MenuRTOSThread::signal() {
+  if (handle) {
+    xTaskNotifyGive(handle);
+  }
+}
+
+// a tick and not taskYIELD, the renderer is on the other core and the loop task's watchdog wants feeding
+void MenuRTOSThread::yield() {
+  vTaskDelay(1);
+}
+
+void MenuRTOSThread::join() {
+  while (!done) {
+    vTaskDelay(1);
+  }
+  handle = nullptr;
+}
+
+#endif
+
+#ifndef ARDUINO
+
+bool MenuStdThread::start(void (*Run)(void *Arg), void *Arg) {
+  t = std::thread(Run, Arg);
+  return true;
+}
+
+void MenuStdThread::wait() {
+  std::unique_lock<std::mutex> l(m);
+  c.wait_for(l, std::chrono::milliseconds(10), [this] { return woken; });
+  woken = false;
+}
+
+void MenuStdThread::signal() {
+  {
+    std::lock_guard<std::mutex> l(m);
+    woken = true;
+  }
+  c.notify_one();
+}
+
+void MenuStdThread::yield() {
+  std::this_thread::yield();
+}
+
+void MenuStdThread::join() {
+  if (t.joinable()) {
+    t.join();
+  }
+}
+
+#endif
+
+#endif
+
+// FNV-1a over the pixels of the tile at column X, row Y
+uint32_t MenuCanvas::checksum(int16_t X, int16_t Y) {
+
+  uint16_t *p = getBuffer() + (Y * ts * width()) + (X * ts);
+  int16_t w = min((int16_t) ts, (int16_t) (width() - X * ts));
+  int16_t h = min((int16_t) ts, (int16_t) (height() - Y * ts));
+  int16_t i, j;
+  uint32_t s = 2166136261UL;
+
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++) {
+      s = (s ^ p[i]) * 16777619UL;
+    }
+    p += width();
+  }
+  return s;
+
+}
+
+// sends the tiles drawn on since the last flush that differ from what the panel shows, tiles
+// side by side in a row go out in one address window, returns the tiles sent
+uint16_t MenuCanvas::flush() {
+
+  uint16_t *buf = getBuffer();
+  int16_t r, c, run, x, y, w, h, j;
+  uint16_t t;
+  uint32_t s;
+  bool send, open = false;
+
+  drawn = 0;
+  dirty = 0;
+  if ((!buf) || (!marks) || (!sum)) {
+    return 0;
+  }
+
+  for (r = 0; r < rows; r++) {
+    run = -1;
+    // one past the last column closes the last run
+    for (c = 0; c <= cols; c++) {
+      send = false;
+      if (c < cols) {
+        t = r * cols + c;
+        if (all || (marks[t >> 3] & (1 << (t & 7)))) {
+          drawn++;
+          s = checksum(c, r);
+          send = all || (s != sum[t]);
+          sum[t] = s;
+        }
+      }
+      if (send) {
+        dirty++;
+        if (run < 0) {
+          run = c;
+        }
+        continue;
+      }
+      if (run < 0) {
+        continue;
+      }
+      x = run * ts;
+      y = r * ts;
+      w = min((int16_t) (c * ts), width()) - x;
+      h = min((int16_t) ts, (int16_t) (height() - y));
+      run = -1;
+#if MENU_PIPELINE
+      if (pipe && pipe->push(buf + (y * width()) + x, width(), x, y, w, h)) {
+        continue;
+      }
+#endif
+      if (!open) {
+        d->startWrite();
+        open = true;
+      }
+      d->setAddrWindow(x, y, w, h);
+      for (j = 0; j < h; j++) {
+        d->writePixels(buf + ((y + j) * width()) + x, w);
+      }
+    }
+  }
+  if (open) {
+    d->endWrite();
+  }
+
+  memset(marks, 0, (tiles + 7) / 8);
+  all = false;
+  flushes++;
+  sent += dirty;
+  return dirty;
+
+}
+
+static const uint32_t scale10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+// formats a value the way Print::print(float, places) does, but with one scale and integer
+// math instead of a float multiply per digit, Buf needs MENU_VALUE_LEN chars, public so a
+// sketch can time it (Examples/Menu_FormatTiming)
+char *EditMenu::formatValue(char *Buf, float Value, uint8_t Places) {
+
+  char tmp[12];
+  char *p = Buf;
+  uint32_t whole, frac;
+  float a;
+  int8_t i;
+
+  if (isnan(Value)) return strcpy(Buf, "nan");
+  if (isinf(Value)) return strcpy(Buf, "inf");
+  if ((Value > 4294967040.0) || (Value < -4294967040.0)) return strcpy(Buf, "ovf");
+
+  if (Places > 9) {
+    Places = 9;
+  }
+  if (Value < 0.0) {
+    *p++ = '-';
+  }
+  // same half up rounding as Print, then the digits come from integers
+  a = fabs(Value) + 0.5f / scale10[Places];
+  whole = (uint32_t) a;
+  frac = (uint32_t) ((a - whole) * scale10[Places]);
+  if (frac >= scale10[Places]) {
+    frac = scale10[Places] - 1;
+  }
+
+  i = 0;
+  do {
+    tmp[i++] = '0' + (whole % 10);
+    whole /= 10;
+  } while (whole);
+  while (i) {
+    *p++ = tmp[--i];
+  }
+
+  if (Places) {
+    *p++ = '.';
+    for (i = Places - 1; i >= 0; i--) {
+      p[i] = '0' + (frac % 10);
+      frac /= 10;
+    }
+    p += Places;
+  }
+  *p = 0;
+
+  return Buf;
+}
+
+// an ITEM_INT value, no float anywhere
+static char *formatInt(char *Buf, int32_t Value) {
+
+  char tmp[12];
+  char *p = Buf;
+  uint32_t n = (Value < 0) ? 0 - (uint32_t) Value : (uint32_t) Value;
+  int8_t i = 0;
+
+  if (Value < 0) {
+    *p++ = '-';
+  }
+  do {
+    tmp[i++] = '0' + (n % 10);
+    n /= 10;
+  } while (n);
+  while (i) {
+    *p++ = tmp[--i];
+  }
+  *p = 0;
+
+  return Buf;
+}
+
+// a value times 10^Places as an integer, capped at 9 digits
+static uint32_t scaledValue(float Value, uint8_t Places) {
+
+  float a = fabs(Value) * scale10[Places] + 0.5f;
+
+  if (!(a < 999999999.0f)) {
+    return 999999999;
+  }
+  return (uint32_t) a;
+}
+
+// a MenuNumber out of a table in flash, read as its bits so an int comes back whole, .f of
+// a number item reads the same bits back through the union
+static MenuNumber readNumber(const MenuNumber *Number) {
+  return MenuNumber((int32_t) pgm_read_dword(Number), true);
+}
+
+// a value being edited a digit at a time, Scaled its size in units of the last place, Digits
+// whole digits with leading zeros and a sign when Sign is set so every digit keeps its place
+// as the value changes
+static char *formatDigits(char *Buf, uint32_t Scaled, bool Negative, uint8_t Places, uint8_t Digits, bool Sign) {
+
+  char *p = Buf;
+  uint32_t s = Scaled;
+  int8_t i;
+
+  if (Sign) {
+    *p++ = Negative ? '-' : '+';
+  }
+  for (i = Digits + Places - 1; i >= 0; i--) {
+    *p++ = '0' + ((s / scale10[i]) % 10);
+    if ((i == Places) && (Places > 0)) {
+      *p++ = '.';
+    }
+  }
+  *p = 0;
+
+  return Buf;
+}
+
+// pixels the cursor moves for one character, the built in font is 6 wide at size 1
+static uint8_t glyphAdvance(const GFXfont *Font, uint8_t c) {
+
+  uint16_t first;
+  const GFXglyph *glyph;
+
+  if (!Font) {
+    return 6;
+  }
+  first = pgm_read_word(&Font->first);
+  if ((c < first) || (c > pgm_read_word(&Font->last))) {
+    return 0;
+  }
+  glyph = (const GFXglyph *) pgm_read_ptr(&Font->glyph);
+  return pgm_read_byte(&glyph[c - first].xAdvance);
+}
+
+// next code point of a UTF-8 string, bytes that do not start a valid sequence come back as
+// themselves so Latin-1 text finds its glyphs too
+static uint16_t utf8Next(const char *&Text) {
+
+  uint8_t c = *Text++;
+  uint8_t n;
+  uint16_t cp;
+
+  if (c < 0xC0) {
+    return c;
+  }
+  if (c < 0xE0) {
+    n = 1;
+    cp = c & 0x1F;
+  }
+  else if (c < 0xF0) {
+    n = 2;
+    cp = c & 0x0F;
+  }
+  else {
+    n = 3;
+    cp = 0;
+  }
+  while (n--) {
+    if ((*Text & 0xC0) != 0x80) {
+      return c;
+    }
+    cp = (cp << 6) | (*Text++ & 0x3F);
+  }
+  // past the 16 bit plane, nothing in an atlas will match
+  return (c < 0xF0) ? cp : 0xFFFD;
+}
+
+// an atlas is drawn with write(first + index), a uint8_t, so its font has to end by 0xFF and
+// hold no more than MENU_GLYPHS glyphs
+static bool glyphsFit(const MenuGlyphs *G) {
+
+  uint16_t first, last;
+
+  if (!G) {
+    return true;
+  }
+  first = pgm_read_word(&G->font.first);
+  last = pgm_read_word(&G->font.last);
+  return (first <= last) && (last <= 0xFF) && ((last - first) < MENU_GLYPHS);
+}
+
+// index of a code point in the glyph atlas, binary search of the sorted code table
+static int16_t atlasIndex(const MenuGlyphs *G, uint16_t Code) {
+
+  const uint16_t *code = (const uint16_t *) pgm_read_ptr(&G->code);
+  int16_t lo = 0, hi = pgm_read_word(&G->font.last) - pgm_read_word(&G->font.first), mid;
+  uint16_t m;
+
+  while (lo <= hi) {
+    mid = (lo + hi) / 2;
+    m = pgm_read_word(&code[mid]);
+    if (m == Code) {
+      return mid;
+    }
+    if (m < Code) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid - 1;
+    }
+  }
+  return -1;
+}
+
+// advance of the character at Text[i] and steps i past it, a whole sequence with an atlas
+static uint8_t codeAdvance(const GFXfont *Font, const MenuGlyphs *G, const char *Text, uint8_t &i) {
+
+  const char *p = Text + i;
+  int16_t a;
+
+  if ((!G) || ((uint8_t) *p < 0x80)) {
+    i++;
+    return glyphAdvance(Font, *p);
+  }
+  a = atlasIndex(G, utf8Next(p));
+  i = p - Text;
+  if (a < 0) {
+    return 0;
+  }
+  return pgm_read_byte(&((const GFXglyph *) pgm_read_ptr(&G->font.glyph))[a].xAdvance);
+}
+
+static int16_t textAdvance(const GFXfont *Font, const MenuGlyphs *G, const char *Text) {
+
+  int16_t w = 0;
+  uint8_t i = 0;
+
+  while (Text[i]) {
+    w += codeAdvance(Font, G, Text, i);
+  }
+  return w;
+}
+
+// bytes of Text that fit in Room pixels, whole characters only
+static uint8_t textFit(const GFXfont *Font, const MenuGlyphs *G, const char *Text, int16_t Room) {
+
+  uint8_t i = 0, k;
+
+  while (Text[i]) {
+    k = i;
+    Room -= codeAdvance(Font, G, Text, i);
+    if (Room < 0) {
+      return k;
+    }
+  }
+  return i;
+}
+
+// adds R to a damage list, R joins a rectangle that holds it or that it lines up with along a
+// whole side, when the list is full it goes into the rectangle that grows least
+static void addDamage(MenuRect *List, uint8_t &Count, const MenuRect &R) {
+
+  MenuRect *q;
+  int16_t x1, y1;
+  int32_t grow, least = 0;
+  uint8_t k, best = 0;
+
+  for (k = 0; k < Count; k++) {
+    q = &List[k];
+    if ((R.x >= q->x) && (R.y >= q->y) && ((R.x + R.w) <= (q->x + q->w)) && ((R.y + R.h) <= (q->y + q->h))) {
+      return;
+    }
+    if ((R.x == q->x) && (R.w == q->w) && (R.y <= (q->y + q->h)) && (q->y <= (R.y + R.h))) {
+      y1 = max(q->y + q->h, R.y + R.h);
+      q->y = min(q->y, R.y);
+      q->h = y1 - q->y;
+      return;
+    }
+    if ((R.y == q->y) && (R.h == q->h) && (R.x <= (q->x + q->w)) && (q->x <= (R.x + R.w))) {
+      x1 = max(q->x + q->w, R.x + R.w);
+      q->x = min(q->x, R.x);
+      q->w = x1 - q->x;
+      return;
+    }
+  }
+  if (Count < MENU_DAMAGE) {
+    List[Count++] = R;
+    return;
+  }
+  for (k = 0; k < Count; k++) {
+    q = &List[k];
+    grow = (int32_t) (max(q->x + q->w, R.x + R.w) - min(q->x, R.x)) * (max(q->y + q->h, R.y + R.h) - min(q->y, R.y)) -
+           ((int32_t) q->w * q->h);
+    if ((k == 0) || (grow < least)) {
+      least = grow;
+      best = k;
+    }
+  }
+  q = &List[best];
+  x1 = max(q->x + q->w, R.x + R.w);
+  y1 = max(q->y + q->h, R.y + R.h);
+  q->x = min(q->x, R.x);
+  q->y = min(q->y, R.y);
+  q->w = x1 - q->x;
+  q->h = y1 - q->y;
+}
+
+// prints Len bytes of UTF-8 text in Font, ASCII goes out in runs and anything past it is drawn
+// inline from the atlas with the same cursor and color, code points not in the atlas are skipped
+static void printText(Adafruit_GFX *Out, const GFXfont *Font, const MenuGlyphs *G, const char *Text, size_t Len) {
+
+  const char *end = Text + Len, *run;
+  int16_t a;
+
+  if (!G) {
+    Out->write((const uint8_t *) Text, Len);
+    return;
+  }
+  while (Text < end) {
+    run = Text;
+    while ((Text < end) && ((uint8_t) *Text < 0x80)) {
+      Text++;
+    }
+    if (Text > run) {
+      Out->write((const uint8_t *) run, Text - run);
+    }
+    if (Text >= end) {
+      break;
+    }
+    a = atlasIndex(G, utf8Next(Text));
+    if (a >= 0) {
+      // setGlyphs took only fonts that end by 0xFF, so this stays a byte
+      Out->setFont(&G->font);
+      Out->write((uint8_t) (pgm_read_word(&G->font.first) + a));
+      Out->setFont(Font);
+    }
+  }
+}
+
+// reads a packed icon one pixel at a time straight from flash, nothing is buffered
+// byte 0 is the palette size n (1 to 255), then n RGB565 colors low byte first, then the runs
+// left to right and top to bottom, runs carry on across rows, with n up to 16 a run is one
+// byte, length - 1 in the high nibble and the palette index in the low one, otherwise a run is
+// two bytes, length - 1 then the index
+struct MenuUnpack {
+
+  const unsigned char *pal, *p;
+  uint8_t n;
+  uint16_t left, color;
+
+  void begin(const unsigned char *Data) {
+    n = pgm_read_byte(Data);
+    pal = Data + 1;
+    p = pal + (2 * n);
+    left = 0;
+  }
+
+  void run() {
+    uint8_t b = pgm_read_byte(p++), k;
+    if (n <= 16) {
+      left = (b >> 4) + 1;
+      k = b & 0x0F;
+    }
+    else {
+      left = b + 1;
+      k = pgm_read_byte(p++);
+    }
+    color = pgm_read_byte(pal + (2 * k)) | (pgm_read_byte(pal + (2 * k) + 1) << 8);
+  }
+
+  uint16_t next() {
+    if (!left) {
+      run();
+    }
+    left--;
+    return color;
+  }
+
+  void skip(uint32_t Pixels) {
+    uint16_t k;
+    while (Pixels) {
+      if (!left) {
+        run();
+      }
+      k = (left < Pixels) ? left : Pixels;
+      left -= k;
+      Pixels -= k;
+    }
+  }
+
+};
+
+// an address window filled left to right and top to bottom with runs of one color, on the
+// panel it is one SPI burst, on a canvas the runs are cut into lines at the window edge
+struct MenuBurst {
+
+  Adafruit_ST7735 *d;
+  MenuCanvas *cv;
+  int16_t x, y, w, cx, cy;
+
+  void begin(Adafruit_ST7735 *Display, MenuCanvas *Canvas, int16_t X, int16_t Y, int16_t W, int16_t H) {
+    d = Display;
+    cv = Canvas;
+    x = X;
+    y = Y;
+    w = W;
+    cx = 0;
+    cy = 0;
+    if (!cv) {
+      d->startWrite();
+      d->setAddrWindow(X, Y, W, H);
+    }
+  }
+
+  void color(uint16_t Color, uint32_t Count) {
+    int16_t n;
+    if (!cv) {
+      d->writeColor(Color, Count);
+      return;
+    }
+    while (Count) {
+      n = ((uint32_t) (w - cx) < Count) ? (w - cx) : Count;
+      cv->drawFastHLine(x + cx, y + cy, n, Color);
+      Count -= n;
+      cx += n;
+      if (cx == w) {
+        cx = 0;
+        cy++;
+      }
+    }
+  }
+
+  void end() {
+    if (!cv) {
+      d->endWrite();
+    }
+  }
+
+};
+
+// writes rows [from, from + h) of a text strip at x, y using one address window
+// text pixels get fg, the rest bg, and an icon if any is laid over at bx, by, the icon is the
+// bw x bh rectangle at sx, sy of a bitmap sw pixels wide, sw is bw for a plain icon
+static void blitStrip(Adafruit_ST7735 *d, MenuCanvas *cv, GFXcanvas1 *c, int16_t x, int16_t y, int16_t from, int16_t h,
+                      uint16_t fg, uint16_t bg, byte type, const void *bits, uint16_t sw, uint16_t sx, uint16_t sy,
+                      int16_t bx, int16_t by, uint8_t bw, uint8_t bh, uint16_t mc) {
+
+  int16_t w = c->width();
+  int16_t bpr = (w + 7) / 8;
+  uint8_t *buf = c->getBuffer();
+  int16_t ii, jj, run;
+  uint16_t pc, lc;
+  bool inicon;
+  MenuUnpack pk = {};
+  MenuBurst b = {};
+
+  if ((type == ICON_PACKED) && (from < by + bh)) {
+    // icon pixels are asked for in order, start at the first row in the strip
+    pk.begin((const unsigned char *) bits);
+    pk.skip((uint32_t) (sy + ((from > by) ? (from - by) : 0)) * sw + sx);
+  }
+
+  b.begin(d, cv, x, y + from, w, h);
+
+  for (jj = from; jj < from + h; jj++) {
+    run = 0;
+    lc = bg;
+    for (ii = 0; ii < w; ii++) {
+      pc = (buf[jj * bpr + (ii >> 3)] & (0x80 >> (ii & 7))) ? fg : bg;
+      inicon = (type != ICON_NONE) && (ii >= bx) && (ii < bx + bw) && (jj >= by) && (jj < by + bh);
+      if (inicon && (type == ICON_565)) {
+        pc = pgm_read_word_near((const uint16_t *) bits + (uint32_t) (sy + jj - by) * sw + sx + (ii - bx));
+      }
+      else if (inicon && (type == ICON_MONO)) {
+        if (pgm_read_byte((const uint8_t *) bits + (uint32_t) (sy + jj - by) * ((sw + 7) / 8) + ((sx + ii - bx) >> 3)) &
+            (0x80 >> ((sx + ii - bx) & 7))) {
+          pc = mc;
+        }
+      }
+      else if (inicon && (type == ICON_PACKED)) {
+        pc = pk.next();
+        if ((ii == bx + bw - 1) && (jj < by + bh - 1)) {
+          // rest of the sheet row
+          pk.skip(sw - bw);
+        }
+      }
+      // send runs of the same color in one go
+      if ((pc != lc) && (run > 0)) {
+        b.color(lc, run);
+        run = 0;
+      }
+      lc = pc;
+      run++;
+    }
+    b.color(lc, run);
+  }
+
+  b.end();
+  MENU_PIXELS((uint32_t) w * h);
+
+}
+
+// draws the w x h rectangle at sx, sy of a bitmap sw pixels wide at x, y, mono pixels that are
+// set get mc and the rest are left alone, 565 and packed go out in runs in one address window
+static void blitIcon(Adafruit_ST7735 *d, MenuCanvas *cv, int16_t x, int16_t y, byte type, const void *bits, uint16_t sw,
+                     uint16_t sx, uint16_t sy, uint8_t w, uint8_t h, uint16_t mc) {
+
+  MenuUnpack pk = {};
+  MenuBurst b = {};
+  Adafruit_GFX *g = cv ? (Adafruit_GFX *) cv : d;
+  int16_t ii, jj, run;
+  uint16_t pc, lc = 0;
+  bool window = (x >= 0) && (y >= 0) && ((x + w) <= g->width()) && ((y + h) <= g->height());
+
+  if (type == ICON_PACKED) {
+    pk.begin((const unsigned char *) bits);
+    pk.skip((uint32_t) sy * sw + sx);
+  }
+  if ((type != ICON_MONO) && window) {
+    b.begin(d, cv, x, y, w, h);
+  }
+
+  for (jj = 0; jj < h; jj++) {
+    run = 0;
+    for (ii = 0; ii < w; ii++) {
+      if (type == ICON_MONO) {
+        if (pgm_read_byte((const uint8_t *) bits + (uint32_t) (sy + jj) * ((sw + 7) / 8) + ((sx + ii) >> 3)) &
+            (0x80 >> ((sx + ii) & 7))) {
+          g->drawPixel(x + ii, y + jj, mc);
+        }
+        continue;
+      }
+      pc = (type == ICON_565) ? pgm_read_word_near((const uint16_t *) bits + (uint32_t) (sy + jj) * sw + sx + ii) : pk.next();
+      if (!window) {
+        g->drawPixel(x + ii, y + jj, pc);
+        continue;
+      }
+      if ((pc != lc) && (run > 0)) {
+        b.color(lc, run);
+        run = 0;
+      }
+      lc = pc;
+      run++;
+    }
+    if (run > 0) {
+      b.color(lc, run);
+    }
+    if ((type == ICON_PACKED) && (jj < h - 1)) {
+      pk.skip(sw - w);
+    }
+  }
+
+  if ((type != ICON_MONO) && window) {
+    b.end();
+  }
+  MENU_PIXELS((uint32_t) w * h);
+
+}
+
+// writes columns [left, width) of rows [from, from + h) of a text strip at x + left, y
+static void blitBand(Adafruit_ST7735 *d, MenuCanvas *cv, GFXcanvas1 *c, int16_t x, int16_t y, int16_t left, int16_t from, int16_t h,
+                     uint16_t fg, uint16_t bg) {
+
+  int16_t w = c->width();
+  int16_t bpr = (w + 7) / 8;
+  uint8_t *buf = c->getBuffer();
+  int16_t ii, jj, run;
+  uint16_t pc, lc;
+  MenuBurst b = {};
+
+  if ((left >= w) || (h <= 0)) {
+    return;
+  }
+
+  b.begin(d, cv, x + left, y + from, w - left, h);
+
+  for (jj = from; jj < from + h; jj++) {
+    run = 0;
+    lc = bg;
+    for (ii = left; ii < w; ii++) {
+      pc = (buf[jj * bpr + (ii >> 3)] & (0x80 >> (ii & 7))) ? fg : bg;
+      if ((pc != lc) && (run > 0)) {
+        b.color(lc, run);
+        run = 0;
+      }
+      lc = pc;
+      run++;
+    }
+    b.color(lc, run);
+  }
+
+  b.end();
+  MENU_PIXELS((uint32_t) (w - left) * h);
+
+}
+
+#define OP_RECT 1
+#define OP_TEXT 2
+#define OP_ICON 3		// x, y, w, h of the icon and the mono color, then two OP_DATA
+#define OP_DATA 4		// sx, sy, sw of the sheet, then the bitmap pointer
+
+MenuList::MenuList(Adafruit_ST7735 *Display, uint16_t MaxOps, MenuCanvas *Canvas) : Adafruit_GFX(Display->width(), Display->height()) {
+  d = Display;
+  cv = Canvas;
+  out = cv ? (Adafruit_GFX *) cv : d;
+  cap = MaxOps;
+  cur = new MenuOp[cap];
+  old = new MenuOp[cap];
+}
+
+MenuList::~MenuList() {
+  delete [] cur;
+  delete [] old;
+}
+
+void MenuList::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  rect(x, y, 1, 1, color);
+}
+
+void MenuList::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  rect(x, y, w, 1, color);
+}
+
+void MenuList::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  rect(x, y, 1, h, color);
+}
+
+// the cursor moves and wraps as Adafruit_GFX::write has it, the character is recorded
+size_t MenuList::write(uint8_t c) {
+
+  const GFXglyph *glyph;
+  MenuOp op;
+  uint8_t first, w, h, k;
+  int16_t xo;
+
+  if ((c == '\n') || (c == '\r')) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * (gfxFont ? pgm_read_byte(&gfxFont->yAdvance) : 8);
+    }
+    return 1;
+  }
+  if (gfxFont) {
+    first = pgm_read_byte(&gfxFont->first);
+    if ((c < first) || (c > pgm_read_byte(&gfxFont->last))) {
+      return 1;
+    }
+    glyph = &((const GFXglyph *) pgm_read_ptr(&gfxFont->glyph))[c - first];
+    w = pgm_read_byte(&glyph->width);
+    h = pgm_read_byte(&glyph->height);
+    xo = (int8_t) pgm_read_byte(&glyph->xOffset);
+  }
+  else {
+    w = 6;
+    h = 8;
+    xo = 0;
+  }
+  if ((w > 0) && (h > 0)) {
+    if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width)) {
+      cursor_x = 0;
+      cursor_y += textsize_y * (gfxFont ? pgm_read_byte(&gfxFont->yAdvance) : 8);
+    }
+    for (k = 0; (k < nf) && (fonts[k] != gfxFont); k++) {
+    }
+    if (k == MENU_LIST_FONTS) {
+      // no room to tell this font apart, the rest of the draw goes out as it comes
+      add(nullptr, 0);
+      out->setFont(gfxFont);
+      out->setTextColor(textcolor);
+      out->setCursor(cursor_x, cursor_y);
+      out->write(c);
+    }
+    else {
+      if (k == nf) {
+        fonts[nf++] = gfxFont;
+      }
+      op.op = OP_TEXT;
+      op.a = c;
+      op.x = cursor_x;
+      op.y = cursor_y;
+      op.w = k;
+      op.h = 0;
+      op.c = textcolor;
+      add(&op, 1);
+    }
+  }
+  cursor_x += textsize_x * (gfxFont ? glyphAdvance(gfxFont, c) : 6);
+  return 1;
+
+}
+
+// the w x h rectangle at SX, SY of a bitmap SW pixels wide, as blitIcon takes it
+void MenuList::icon(int16_t X, int16_t Y, uint8_t Type, const void *Bits, uint16_t SW, uint16_t SX, uint16_t SY,
+                    uint8_t W, uint8_t H, uint16_t Color) {
+
+  MenuOp op[3];
+
+  memset(op, 0, sizeof(op));
+  op[0].op = OP_ICON;
+  op[0].a = Type;
+  op[0].x = X;
+  op[0].y = Y;
+  op[0].w = W;
+  op[0].h = H;
+  op[0].c = Color;
+  op[1].op = OP_DATA;
+  op[1].x = SX;
+  op[1].y = SY;
+  op[1].w = SW;
+  op[2].op = OP_DATA;
+  memcpy(&op[2].x, &Bits, min(sizeof(Bits), (size_t) 8));
+  add(op, 3);
+
+}
+
+void MenuList::begin() {
+  n = 0;
+  through = false;
+}
+
+// sends the ops that differ from the last draw, and any op over pixels sent so far, the screen
+// holds the last draw so every other pixel is already right, this takes a draw to paint at least
+// where the last one did, which a menu's draw() does
+void MenuList::end() {
+
+  MenuRect dirty[MENU_DAMAGE], r;
+  uint8_t nd = 0, j;
+  uint16_t k;
+  MenuOp *t;
+
+  draws++;
+  ops = n;
+  played = 0;
+  if (through) {
+    // went out as it came
+    overflows++;
+    played = n;
+    valid = false;
+    return;
+  }
+
+  if (valid) {
+    for (k = 0; k < max(n, m); k++) {
+      if ((k < n) && (k < m) && (memcmp(&cur[k], &old[k], sizeof(MenuOp)) == 0)) {
+        continue;
+      }
+      if (k < m) {
+        addDamage(dirty, nd, box(old, k));
+      }
+      if (k < n) {
+        addDamage(dirty, nd, box(cur, k));
+      }
+    }
+  }
+
+  for (k = 0; k < n; k++) {
+    if (cur[k].op == OP_DATA) {
+      continue;
+    }
+    if (valid) {
+      r = box(cur, k);
+      for (j = 0; j < nd; j++) {
+        if ((r.x < dirty[j].x + dirty[j].w) && (dirty[j].x < r.x + r.w) &&
+            (r.y < dirty[j].y + dirty[j].h) && (dirty[j].y < r.y + r.h)) {
+          break;
+        }
+      }
+      if (j == nd) {
+        continue;
+      }
+      // whatever comes later over these pixels has to be sent again too
+      addDamage(dirty, nd, r);
+    }
+    play(&cur[k]);
+    played++;
+  }
+
+  t = old;
+  old = cur;
+  cur = t;
+  m = n;
+  n = 0;
+  valid = true;
+
+}
+
+// the next draw goes out whole, for when something else drew on the screen
+void MenuList::invalidate() {
+  valid = false;
+}
+
+// appends Count ops, a rectangle next to the last one in the same color joins it, Op nullptr just
+// starts drawing ops as they come
+void MenuList::add(const MenuOp *Op, uint8_t Count) {
+
+  MenuOp *l = n ? &cur[n - 1] : nullptr;
+  uint16_t k;
+
+  if ((!through) && ((!Op) || (n + Count > cap))) {
+    for (k = 0; k < n; k++) {
+      if (cur[k].op != OP_DATA) {
+        play(&cur[k]);
+      }
+    }
+    through = true;
+  }
+  if (!Op) {
+    return;
+  }
+  if (through) {
+    play(Op);
+    return;
+  }
+  if ((Count == 1) && (Op->op == OP_RECT) && l && (l->op == OP_RECT) && (l->c == Op->c)) {
+    if ((l->y == Op->y) && (l->h == Op->h) && (l->x + l->w == Op->x)) {
+      l->w += Op->w;
+      return;
+    }
+    if ((l->x == Op->x) && (l->w == Op->w) && (l->y + l->h == Op->y)) {
+      l->h += Op->h;
+      return;
+    }
+  }
+  memcpy(&cur[n], Op, Count * sizeof(MenuOp));
+  n += Count;
+
+}
+
+void MenuList::rect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+
+  MenuOp op;
+
+  if ((W <= 0) || (H <= 0)) {
+    return;
+  }
+  op.op = OP_RECT;
+  op.a = 0;
+  op.x = X;
+  op.y = Y;
+  op.w = W;
+  op.h = H;
+  op.c = Color;
+  add(&op, 1);
+
+}
+
+void MenuList::play(const MenuOp *Op) {
+
+  const void *bits = nullptr;
+
+  switch (Op->op) {
+    case OP_RECT:
+      fill(out, Op->x, Op->y, Op->w, Op->h, Op->c);
+      break;
+    case OP_TEXT:
+      out->setFont(fonts[Op->w]);
+      out->setTextColor(Op->c);
+      out->setCursor(Op->x, Op->y);
+      out->write(Op->a);
+      break;
+    case OP_ICON:
+      memcpy(&bits, &Op[2].x, min(sizeof(bits), (size_t) 8));
+      blitIcon(d, cv, Op->x, Op->y, Op->a, bits, Op[1].w, Op[1].x, Op[1].y, Op->w, Op->h, Op->c);
+      break;
+  }
+
+}
+
+// the screen rectangle op K of List can draw on
+MenuRect MenuList::box(const MenuOp *List, uint16_t K) {
+
+  const GFXglyph *glyph;
+  const GFXfont *f;
+  MenuRect r;
+
+  while ((K > 0) && (List[K].op == OP_DATA)) {
+    K--;
+  }
+  r.x = List[K].x;
+  r.y = List[K].y;
+  r.w = List[K].w;
+  r.h = List[K].h;
+  if (List[K].op == OP_TEXT) {
+    f = fonts[List[K].w];
+    if (!f) {
+      r.w = 6 * textsize_x;
+      r.h = 8 * textsize_y;
+    }
+    else {
+      glyph = &((const GFXglyph *) pgm_read_ptr(&f->glyph))[List[K].a - pgm_read_byte(&f->first)];
+      r.x += (int8_t) pgm_read_byte(&glyph->xOffset);
+      r.y += (int8_t) pgm_read_byte(&glyph->yOffset);
+      r.w = pgm_read_byte(&glyph->width) * textsize_x;
+      r.h = pgm_read_byte(&glyph->height) * textsize_y;
+    }
+  }
+  return r;
+
+}
+
+EditMenu::EditMenu(Adafruit_ST7735 *Display, bool EnableTouch) {
+  d = Display;
+  tft = Display;
+  enabletouch = EnableTouch;
+}
+
+EditMenu::~EditMenu() {
+  delete strip;
+}
+
+// the scroll strip is as wide and as high as a row, anything that moves the row edges or the
+// row height drops it and the next drag makes a new one
+void EditMenu::dropStrip() {
+  delete strip;
+  strip = nullptr;
+}
+
+void EditMenu::init(uint16_t TextColor, uint16_t BackgroundColor,
+                    uint16_t HighlightTextColor, uint16_t HighlightColor,
+                    uint16_t SelectedTextColor, uint16_t SelectedColor,
+                    uint16_t MenuColumn, uint16_t ItemRowHeight, uint16_t MaxRow,
+                    const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont) {
+
+  itc = TextColor;
+  ibc = BackgroundColor;
+  ihtc = HighlightTextColor;
+  ihbc = HighlightColor;
+  istc = SelectedTextColor;
+  isbc = SelectedColor;
+
+  bcolor = TextColor;
+  sbcolor = TextColor;
+  tbt = 0;        // title bar top
+  tbl = 0;        // title bar left
+  tbh = 40;       // title bar height
+  tbw = d->width(); // title bar width, default to screen width
+  tox = 20;       // x pixel offset for title text to manage centering
+  toy  = 8;       // y pixel offset for title text to manage height centering
+  isx = 10;       // where to start the menu item from left, default indent 10
+  mm = 5;
+  // isy = tbt + tbh - ItemRowHeight + mm;  // where to start the menu item from top, default below menu bar by 10, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
+
+  isy = tbt + tbh + mm;  // where to start the menu item from top, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
+
+  irh = ItemRowHeight;  // select bar height
+  irw = tbw - isx;    // select bar width, default to full width
+  col = MenuColumn;
+  imr = MaxRow;     // user has to indicate this
+  iox = 0;  // pixels to offset text in menu bar
+  ioy = 0;  // pixels to offset text in menu bar
+  itemf = &ItemFont;     // item font
+  titlef = &TitleFont;     // title font
+  ttc = TextColor;      // title text color
+  tfc = HighlightColor;     // title fill color
+  ditc = MENU_C_DKGREY;
+  strncpy(ttx, TitleText, MAX_CHAR_LEN);
+  strncpy(etx, EXIT_TEXT, MAX_CHAR_LEN);
+  currentID = 1;    // id of current highlighted or selected item (1 to ID)
+  cr = 1;       // current selected row on the screen (1 to mr-1)
+  totalID = 0;    // maximum number of items (where first position is 1)
+  sr = 0;       // draw offset for the menu array where first postion is 0
+  pr = 1;       // previous selected rown (1 to mr - 1)
+  rowselected = false;
+  enablestate[0] = true;
+  radius = 0;
+  thick = 0;
+  icox = 0;
+  icoy = 0;
+  // a menu on the stack or the heap starts out with junk in these
+  memset(pendrow, 0, sizeof(pendrow));
+  memset(aicon, 0, sizeof(aicon));
+#if MENU_BIND
+  memset(boundtype, 0, sizeof(boundtype));
+#endif
+  vtx[0] = 0;
+  vid = 0;
+  dropStrip();
+}
+
+void EditMenu::setInitialItem(int ItemID){
+	
+	// not taking into account if the first item is disabled
+	if ((ItemID > totalID) || (ItemID < 0)) {
+		ItemID = 0;
+	}
+	
+	currentID = ItemID;  
+	// items past the first screen go on the last row
+	sr = (ItemID > (int) imr) ? ItemID - imr : 0;
+	cr = ItemID - sr; 
+	pr = cr;
+	dp = digitTop(currentID);
+	
+}
+
+
+#if MENU_ITEM_RAM
+int EditMenu::addNI(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
+                    byte DecimalPlaces, const char **ItemMenuText) {
+
+  totalID++;
+  strcpy(itemlabel[totalID], ItemText);
+  low[totalID] = LowLimit;
+  high[totalID] = HighLimit;
+  inc[totalID] = Increment;
+  dec[totalID] = DecimalPlaces;
+  haslist[totalID] = false;
+  value[totalID] = Data;
+
+  if (ItemMenuText) {
+    haslist[totalID] = true;
+    itemtext[totalID] = (char **) ItemMenuText;
+  }
+
+  IconType[totalID] = ICON_NONE;
+  kind[totalID] = ITEM_FLOAT;
+
+  enablestate[totalID] = true;
+  return (totalID);
+
+}
+int EditMenu::addMono(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
+                      byte DecimalPlaces, const char **ItemMenuText,
+                      const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+  strcpy(itemlabel[totalID], ItemText);
+  low[totalID] = LowLimit;
+  high[totalID] = HighLimit;
+  inc[totalID] = Increment;
+  dec[totalID] = DecimalPlaces;
+  haslist[totalID] = false;
+  value[totalID] = Data;
+
+  if (ItemMenuText) {
+    haslist[totalID] = true;
+    itemtext[totalID] = (char **) ItemMenuText;
+  }
+
+  itemBitmap[totalID] = (unsigned char*) Bitmap;
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_MONO;
+  kind[totalID] = ITEM_FLOAT;
+
+  enablestate[totalID] = true;
+  return (totalID);
+
+}
+
+int EditMenu::add565(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
+                     byte DecimalPlaces, const char **ItemMenuText,
+                     const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+  strcpy(itemlabel[totalID], ItemText);
+  low[totalID] = LowLimit;
+  high[totalID] = HighLimit;
+  inc[totalID] = Increment;
+  dec[totalID] = DecimalPlaces;
+  haslist[totalID] = false;
+  value[totalID] = Data;
+
+  if (ItemMenuText) {
+    haslist[totalID] = true;
+    itemtext[totalID] = (char **) ItemMenuText;
+  }
+
+  item565Bitmap[totalID] = (uint16_t* ) Bitmap;
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_565;
+  kind[totalID] = ITEM_FLOAT;
+
+  enablestate[totalID] = true;
+  return (totalID);
+
+}
+
+int EditMenu::addPacked(const char *ItemText, float Data, float LowLimit, float HighLimit, float Increment,
+                        byte DecimalPlaces, const char **ItemMenuText,
+                        const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+  strcpy(itemlabel[totalID], ItemText);
+  low[totalID] = LowLimit;
+  high[totalID] = HighLimit;
+  inc[totalID] = Increment;
+  dec[totalID] = DecimalPlaces;
+  haslist[totalID] = false;
+  value[totalID] = Data;
+
+  if (ItemMenuText) {
+    haslist[totalID] = true;
+    itemtext[totalID] = (char **) ItemMenuText;
+  }
+
+  // packed icons live in the mono pointer, the type tells them apart
+  itemBitmap[totalID] = Bitmap;
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_PACKED;
+  kind[totalID] = ITEM_FLOAT;
+
+  enablestate[totalID] = true;
+  return (totalID);
+
+}
+
+// typed items, a toggle flips on select with no edit mode and draws as a check box, an enum
+// steps through Count texts and an int steps by Increment between the limits, both wrap round
+int EditMenu::addToggle(const char *ItemText, bool Data) {
+
+  totalID = addNI(ItemText, Data, 0, 1, 1, 0);
+  kind[totalID] = ITEM_TOGGLE;
+  low[totalID] = MenuNumber(0, true);
+  high[totalID] = MenuNumber(1, true);
+  inc[totalID] = MenuNumber(1, true);
+  ival[totalID] = Data;
+  return (totalID);
+
+}
+
+int EditMenu::addEnum(const char *ItemText, uint8_t Data, const char **ItemMenuText, uint8_t Count) {
+
+  totalID = addNI(ItemText, Data, 0, Count, 1, 0, ItemMenuText);
+  kind[totalID] = ITEM_ENUM;
+  low[totalID] = MenuNumber(0, true);
+  high[totalID] = MenuNumber(Count, true);
+  inc[totalID] = MenuNumber(1, true);
+  ival[totalID] = fitInt(totalID, Data);
+  return (totalID);
+
+}
+
+int EditMenu::addInt(const char *ItemText, int32_t Data, int32_t LowLimit, int32_t HighLimit, int32_t Increment) {
+
+  // the limits are kept as ints, as floats they would round past 2^24
+  totalID = addNI(ItemText, Data, LowLimit, HighLimit, Increment, 0);
+  kind[totalID] = ITEM_INT;
+  low[totalID] = MenuNumber(LowLimit, true);
+  high[totalID] = MenuNumber(HighLimit, true);
+  inc[totalID] = MenuNumber(Increment, true);
+  ival[totalID] = Data;
+  return (totalID);
+
+}
+#endif
+
+int EditMenu::addItems(const MenuItemDef *Items, uint8_t Count) {
+
+  // the table is read in place, only the values are copied to RAM
+  defs = Items;
+  totalID = 0;
+
+  for (uint8_t i = 0; (i < Count) && (totalID < MAX_OPT - 1); i++) {
+    totalID++;
+    rlabel[totalID] = nullptr;
+    enablestate[totalID] = true;
+    if (itemKind(totalID) == ITEM_FLOAT) {
+      value[totalID] = readNumber(&Items[i].data).f;
+    }
+    else {
+      ival[totalID] = fitInt(totalID, readNumber(&Items[i].data).i);
+      value[totalID] = ival[totalID];
+    }
+  }
+
+  return (totalID);
+
+}
+
+// low (Which 0), high (1) or increment (2) of item ID as stored, .i for the typed kinds
+MenuNumber EditMenu::limit(int ID, uint8_t Which) {
+  if ((ID < 1) || (ID > totalID)) return MenuNumber();
+#if MENU_ITEM_RAM
+  if (!defs) return (Which == 0) ? low[ID] : ((Which == 1) ? high[ID] : inc[ID]);
+#endif
+  return readNumber((Which == 0) ? &defs[ID - 1].low : ((Which == 1) ? &defs[ID - 1].high : &defs[ID - 1].inc));
+}
+
+float EditMenu::lowLimit(int ID) {
+  MenuNumber n = limit(ID, 0);
+  return (itemKind(ID) == ITEM_FLOAT) ? n.f : n.i;
+}
+
+float EditMenu::highLimit(int ID) {
+  MenuNumber n = limit(ID, 1);
+  return (itemKind(ID) == ITEM_FLOAT) ? n.f : n.i;
+}
+
+float EditMenu::increment(int ID) {
+  MenuNumber n = limit(ID, 2);
+  return (itemKind(ID) == ITEM_FLOAT) ? n.f : n.i;
+}
+
+uint8_t EditMenu::places(int ID) {
+  if ((ID < 1) || (ID > totalID)) return 0;
+#if MENU_ITEM_RAM
+  if (!defs) return dec[ID];
+#endif
+  return pgm_read_byte(&defs[ID - 1].dec);
+}
+
+bool EditMenu::hasList(int ID) {
+  if ((ID < 1) || (ID > totalID)) return false;
+#if MENU_ITEM_RAM
+  if (!defs) return haslist[ID];
+#endif
+  return pgm_read_ptr(&defs[ID - 1].list) != nullptr;
+}
+
+uint8_t EditMenu::itemKind(int ID) {
+  if ((ID < 1) || (ID > totalID)) return ITEM_FLOAT;
+#if MENU_ITEM_RAM
+  if (!defs) return kind[ID];
+#endif
+  return pgm_read_byte(&defs[ID - 1].kind);
+}
+
+// Value as item ID of its kind can hold it, a toggle 0 or 1 and an enum one of its texts
+int32_t EditMenu::fitInt(int ID, int32_t Value) {
+  switch (itemKind(ID)) {
+    case ITEM_TOGGLE:
+      return Value != 0;
+    case ITEM_ENUM:
+      return constrain(Value, 0, limit(ID, 1).i - 1);
+  }
+  return Value;
+}
+
+// a typed item picks up value[] after something other than the menu set it, a value[] that
+// still matches is left alone since an int past 2^24 does not come back from the float whole
+void EditMenu::syncInt(int ID) {
+  if ((itemKind(ID) != ITEM_FLOAT) && (value[ID] != (float) ival[ID])) {
+    ival[ID] = fitInt(ID, (int32_t) round(value[ID]));
+  }
+}
+
+// a typed item one Increment up (Dir 1) or down (-1), enums wrap like lists and ints like
+// numbers do, all in ints
+void EditMenu::stepInt(int ID, int8_t Dir) {
+
+  int32_t n = ival[ID], lo = limit(ID, 0).i, hi = limit(ID, 1).i, in = limit(ID, 2).i;
+
+  switch (itemKind(ID)) {
+    case ITEM_TOGGLE:
+      n = !n;
+      break;
+    case ITEM_ENUM:
+      n += Dir * in;
+      if (n >= hi) {
+        n = lo;
+      }
+      else if (n < lo) {
+        n = hi - 1;
+      }
+      break;
+    default:
+      n += Dir * in;
+      if (n > hi) {
+        n = lo;
+      }
+      else if (n < lo) {
+        n = hi;
+      }
+  }
+  ival[ID] = n;
+  value[ID] = n;
+
+}
+
+// a toggle changes, out to a bound variable and the store like an edit
+void EditMenu::flip(int ID) {
+
+  stepInt(ID, 1);
+  writeBound(ID);
+  lastedit = millis();
+  unsaved = true;
+  item = ID;
+
+}
+
+// the check box of a toggle at the cursor of Out (where the value goes), half the row high,
+// filled in when on
+void EditMenu::drawToggle(Adafruit_GFX *Out, int ID, uint16_t Color) {
+
+  int16_t s = max((irh - (2 * thick)) / 2, 6);
+  int16_t x = Out->getCursorX() + ((vcw > s) ? vcw - s : 0), y = Out->getCursorY() - ioy + ((irh - s) / 2);
+
+  Out->drawRect(x, y, s, s, Color);
+  if (ival[ID]) {
+    fill(Out, x + 2, y + 2, s - 4, s - 4, Color);
+  }
+
+}
+
+// redraws just the check box of toggle ID on its row
+void EditMenu::paintToggle(int ID, uint16_t Fore, uint16_t Back) {
+
+  int16_t s = max((irh - (2 * thick)) / 2, 6);
+  int16_t x = col + ((vcw > s) ? vcw - s : 0), y = isy - irh + (irh * (ID - sr)) + ((irh - s) / 2);
+
+  if (((ID - sr) < 1) || ((ID - sr) > imr)) {
+    return;
+  }
+  fill(d, x + 1, y + 1, s - 2, s - 2, Back);
+  d->setCursor(col, isy - irh + (irh * (ID - sr)) + ioy);
+  drawToggle(d, ID, Fore);
+  touched(x, y, s, s);
+
+}
+
+uint8_t EditMenu::iconType(int ID) {
+  uint8_t t;
+  if ((ID < 1) || (ID > totalID)) return ICON_NONE;
+  if (atlasIcon(ID)) return ICON_ATLAS;
+#if MENU_ITEM_RAM
+  if (!defs) return IconType[ID];
+#endif
+  t = pgm_read_byte(&defs[ID - 1].icon);
+  // an atlas item with no atlas set has no icon
+  return (t == ICON_ATLAS) ? ICON_NONE : t;
+}
+
+const unsigned char *EditMenu::monoBitmap(int ID) {
+  if ((ID < 1) || (ID > totalID)) return nullptr;
+#if MENU_ITEM_RAM
+  if (!defs) return itemBitmap[ID];
+#endif
+  return (const unsigned char *) pgm_read_ptr(&defs[ID - 1].mono);
+}
+
+const uint16_t *EditMenu::colorBitmap(int ID) {
+  if ((ID < 1) || (ID > totalID)) return nullptr;
+#if MENU_ITEM_RAM
+  if (!defs) return item565Bitmap[ID];
+#endif
+  return (const uint16_t *) pgm_read_ptr(&defs[ID - 1].color);
+}
+
+uint8_t EditMenu::iconW(int ID) {
+  uint8_t k;
+  if ((ID < 1) || (ID > totalID)) return 0;
+  k = atlasIcon(ID);
+  if (k) return pgm_read_byte(&((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1].w);
+#if MENU_ITEM_RAM
+  if (!defs) return bmp_w[ID];
+#endif
+  if (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS) return 0;
+  return pgm_read_byte(&defs[ID - 1].w);
+}
+
+uint8_t EditMenu::iconH(int ID) {
+  uint8_t k;
+  if ((ID < 1) || (ID > totalID)) return 0;
+  k = atlasIcon(ID);
+  if (k) return pgm_read_byte(&((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1].h);
+#if MENU_ITEM_RAM
+  if (!defs) return bmp_h[ID];
+#endif
+  if (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS) return 0;
+  return pgm_read_byte(&defs[ID - 1].h);
+}
+
+// atlas icon of an item, setItemIcon wins over a MenuIcon table entry, 0 if none
+uint8_t EditMenu::atlasIcon(int ID) {
+  uint8_t k;
+  if ((!atlas) || (ID < 1) || (ID > totalID)) return 0;
+  k = aicon[ID];
+  if ((!k) && defs && (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS)) {
+    k = pgm_read_byte(&defs[ID - 1].w);
+  }
+  return (k <= pgm_read_byte(&atlas->count)) ? k : 0;
+}
+
+// where the icon pixels of an item are, the atlas sheet and the rectangle in it or the item's
+// own bitmap as a sheet of its own width, returns the bitmap type
+uint8_t EditMenu::iconSheet(int ID, const void *&Bits, uint16_t &Width, uint16_t &X, uint16_t &Y) {
+
+  uint8_t k = atlasIcon(ID), t;
+  const MenuIconRect *r;
+
+  if (k) {
+    r = &((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1];
+    Bits = pgm_read_ptr(&atlas->sheet);
+    Width = pgm_read_word(&atlas->width);
+    X = pgm_read_word(&r->x);
+    Y = pgm_read_word(&r->y);
+    return pgm_read_byte(&atlas->type);
+  }
+  t = iconType(ID);
+  Bits = (t == ICON_565) ? (const void *) colorBitmap(ID) : (const void *) monoBitmap(ID);
+  Width = iconW(ID);
+  X = 0;
+  Y = 0;
+  return t;
+}
+
+void EditMenu::drawAtlasIcon(int16_t x, int16_t y, int ID, uint16_t color) {
+
+  const void *bits;
+  uint16_t sw, sx, sy;
+  uint8_t t = iconSheet(ID, bits, sw, sx, sy);
+
+  if (d == ls) {
+    ls->icon(x, y, t, bits, sw, sx, sy, iconW(ID), iconH(ID), color);
+    return;
+  }
+  blitIcon(tft, cv, x, y, t, bits, sw, sx, sy, iconW(ID), iconH(ID), color);
+
+}
+
+void EditMenu::printLabel(Adafruit_GFX *Out, int ID) {
+
+  char buf[MAX_CHAR_LEN];
+  const char *src;
+  uint8_t k = 0;
+
+  if ((ID < 1) || (ID > totalID)) return;
+
+  if (defs) {
+    if (rlabel[ID]) {
+      src = rlabel[ID];
+    }
+    else if ((!glyphs) && (view.w == 0)) {
+      Out->print((const __FlashStringHelper *) pgm_read_ptr(&defs[ID - 1].label));
+      return;
+    }
+    else {
+      // the atlas lookups and clipping want the label in RAM
+      src = (const char *) pgm_read_ptr(&defs[ID - 1].label);
+      while ((k < MAX_CHAR_LEN - 1) && (buf[k] = pgm_read_byte(src + k))) {
+        k++;
+      }
+      buf[k] = 0;
+      src = buf;
+    }
+  }
+  else {
+#if MENU_ITEM_RAM
+    src = itemlabel[ID];
+#else
+    return;
+#endif
+  }
+  if (view.w > 0) {
+    // the strips start at x0, so their right edge is their width
+    printText(Out, itemf, glyphs, src, textFit(itemf, glyphs, src, ((Out == d) ? irw : Out->width()) - Out->getCursorX()));
+    return;
+  }
+  printText(Out, itemf, glyphs, src, strlen(src));
+
+}
+
+// text for the value of an item, the list entry or the formatted number
+char *EditMenu::valueText(char *Buf, int ID) {
+
+  char num[MENU_VALUE_LEN];
+  const char *src = num;
+  uint8_t k = 0;
+  int n;
+
+  Buf[0] = 0;
+  if ((ID < 1) || (ID > totalID) || (itemKind(ID) == ITEM_TOGGLE)) return Buf;
+
+  if (hasList(ID)) {
+    // a bound variable or SetItemValue can put the value past the list, high limit is the list size,
+    // an enum is kept in it by fitInt
+    n = (itemKind(ID) == ITEM_ENUM) ? ival[ID] : constrain(value[ID], 0, highLimit(ID) - 1);
+    if (defs) {
+      const char * const *list = (const char * const *) pgm_read_ptr(&defs[ID - 1].list);
+      src = (const char *) pgm_read_ptr(&list[n]);
+      while ((k < MAX_CHAR_LEN - 1) && (Buf[k] = pgm_read_byte(src + k))) {
+        k++;
+      }
+      Buf[k] = 0;
+      if (view.w > 0) {
+        Buf[textFit(itemf, glyphs, Buf, irw - col - thick)] = 0;
+      }
+      return Buf;
+    }
+#if MENU_ITEM_RAM
+    src = itemtext[ID][n];
+#endif
+  }
+  else if (digitEdit(ID)) {
+    formatDigits(num, digitValue(ID), digitNegative(ID), places(ID), digits(ID), lowLimit(ID) < 0.0);
+  }
+  else if (itemKind(ID) == ITEM_INT) {
+    formatInt(num, ival[ID]);
+  }
+  else {
+    formatValue(num, value[ID], places(ID));
+  }
+
+  strncpy(Buf, src, MAX_CHAR_LEN - 1);
+  Buf[MAX_CHAR_LEN - 1] = 0;
+  if (view.w > 0) {
+    Buf[textFit(itemf, glyphs, Buf, irw - col - thick)] = 0;
+  }
+  return Buf;
+
+}
+
+// where a value starts, at col or right aligned in the value cell
+int16_t EditMenu::valueX(const char *Text) {
+
+  int16_t w;
+
+  if (vcw == 0) {
+    return col;
+  }
+  w = textAdvance(itemf, glyphs, Text);
+  if (w >= vcw) {
+    return col;
+  }
+  return col + vcw - w;
+
+}
+
+void EditMenu::printValue(Adafruit_GFX *Out, int ID, uint16_t Color) {
+
+  char buf[MAX_CHAR_LEN];
+
+  if (itemKind(ID) == ITEM_TOGGLE) {
+    drawToggle(Out, ID, Color);
+    return;
+  }
+  valueText(buf, ID);
+  if (vcw > 0) {
+    // callers put the cursor at col, shift it over to right align
+    Out->setCursor(Out->getCursorX() + valueX(buf) - col, Out->getCursorY());
+  }
+  printText(Out, itemf, glyphs, buf, strlen(buf));
+
+}
+
+// repaints a value on row Y from Old to Text, a glyph stays when the old text had the same
+// character (the whole UTF-8 sequence) at the same x, the rest of the old glyphs are cleared to Back and the new ones
+// drawn in the current text color
+void EditMenu::paintCell(const char *Old, const char *Text, int16_t Y, uint16_t Back) {
+
+  bool keep[MAX_CHAR_LEN], okeep[MAX_CHAR_LEN];
+  uint8_t n = strlen(Text), on = strlen(Old);
+  uint8_t i = 0, j = 0, k, a, b;
+  int16_t x = valueX(Text), ox = valueX(Old), rx;
+
+  memset(keep, 0, sizeof(keep));
+  memset(okeep, 0, sizeof(okeep));
+
+  while ((i < n) && (j < on)) {
+    if (x == ox) {
+      a = i;
+      b = j;
+      x += codeAdvance(itemf, glyphs, Text, i);
+      ox += codeAdvance(itemf, glyphs, Old, j);
+      if (((i - a) == (j - b)) && (memcmp(Text + a, Old + b, i - a) == 0)) {
+        keep[a] = true;
+        okeep[b] = true;
+      }
+    }
+    else if (x < ox) {
+      x += codeAdvance(itemf, glyphs, Text, i);
+    }
+    else {
+      ox += codeAdvance(itemf, glyphs, Old, j);
+    }
+  }
+
+  // clear runs of old glyphs that go away
+  ox = valueX(Old);
+  j = 0;
+  while (j < on) {
+    if (okeep[j]) {
+      ox += codeAdvance(itemf, glyphs, Old, j);
+      continue;
+    }
+    rx = ox;
+    while ((j < on) && (!okeep[j])) {
+      ox += codeAdvance(itemf, glyphs, Old, j);
+    }
+    fill(d, rx, Y + thick, ox - rx, irh - (2 * thick), Back);
+    touched(rx, Y + thick, ox - rx, irh - (2 * thick));
+  }
+
+  // and draw runs of new ones
+  x = valueX(Text);
+  i = 0;
+  while (i < n) {
+    if (keep[i]) {
+      x += codeAdvance(itemf, glyphs, Text, i);
+      continue;
+    }
+    rx = x;
+    k = i;
+    while ((i < n) && (!keep[i])) {
+      x += codeAdvance(itemf, glyphs, Text, i);
+    }
+    d->setCursor(rx, Y + ioy);
+    printText(d, itemf, glyphs, Text + k, i - k);
+    touched(rx, Y + thick, x - rx, irh - (2 * thick));
+  }
+
+}
+
+int EditMenu::selectRow() {
+
+  if (wake()) {
+    return -1;
+  }
+
+  if (currentID == 0) {
+    // trigger to exit out of the menu
+    if (store) {
+      save();
+    }
+    item = 0;
+    return 0;
+  }
+  // otherwise this is the trigger to enable editing in the row
+
+  if ((itemKind(currentID) == ITEM_TOGGLE) && (!rowselected)) {
+    // a toggle just flips, only its box is drawn
+    flip(currentID);
+    if (fr.period > 0) {
+      pendrow[currentID] = true;
+      fr.request();
+    }
+    else if (enabletouch) {
+      paintToggle(currentID, enablestate[currentID] ? itc : ditc, ibc);
+    }
+    else {
+      paintToggle(currentID, ihtc, ihbc);
+    }
+    return currentID;
+  }
+
+  if (digitEdit(currentID)) {
+    if (dp > -places(currentID)) {
+      // on to the next digit, past the last one the edit ends
+      dp--;
+      showValue();
+      item = currentID;
+      return currentID;
+    }
+    endDigits();
+  }
+
+  rowselected = !rowselected;
+  dp = digitTop(currentID);
+  closeKeypad();
+
+  drawRow(currentID);
+  item = currentID;
+  return currentID;
+
+}
+
+
+// the title bar arrows, 30 wide with the inner tip on the zone edge like they always were when
+// the zone is HEADER_ZONE_W, a zone set to another width with setHeaderZones gets its arrow
+// centered and as wide as the zone less a 5 pixel margin each side, up to 30
+static void headerArrows(Adafruit_GFX *d, int16_t X, int16_t Y, int16_t W, int16_t H, int16_t Up, int16_t Down, uint16_t Color) {
+
+  int16_t hu = min(Up - 10, 30) / 2, hd = min(Down - 10, 30) / 2;
+  int16_t cu = X + ((Up == HEADER_ZONE_W) ? Up - 15 : Up / 2);
+  int16_t cd = X + W - ((Down == HEADER_ZONE_W) ? Down - 15 : Down / 2);
+
+  if (hu > 0) {
+    // up arrow
+    d->fillTriangle( cu + hu , Y + H - 10, // bottom left
+                     cu - hu , Y + H - 10, // bottom right
+                     cu , Y + 10, //center
+                     Color);
+  }
+  if (hd > 0) {
+    // down arrow
+    d->fillTriangle( cd + hd , Y + 10, // top left
+                     cd - hd , Y + 10, // top right
+                     cd , Y + H - 10, //center
+                     Color);
+  }
+}
+
+void EditMenu::drawHeader(bool hl, uint8_t style) {
+
+  MENU_PROBE(PROF_HEADER);
+
+  touched(tbl, tbt, tbw, tbh);
+
+  d->setFont(titlef);
+
+  if (enabletouch) {
+
+    if (style == BUTTON_PRESSED) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ttc);
+      printTitle(ttx);
+    }
+    else {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      printTitle(ttx);
+    }
+
+    if (totalID > imr) {
+      headerArrows(d, tbl, tbt, tbw, tbh, huw, hdw, ttc);
+    }
+
+  }
+  else {
+    if (hl) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ihtc);
+      printTitle(etx);
+
+      d->fillTriangle( tbl + tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) - 3,
+                       tbl + tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) - (tbh / 3.0),
+                       tbl + tbw - 5,       tbt + (tbh / 2.0) - 3,
+                       ihtc);
+
+      d->fillTriangle( tbl + tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) + 3,
+                       tbl + tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) + (tbh / 3.0),
+                       tbl + tbw - 5,       tbt + (tbh / 2.0) + 3,
+                       ihtc);
+    }
+
+    else {
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      printTitle(ttx);
+    }
+  }
+
+
+
+}
+
+int EditMenu::press(int16_t ScreenX, int16_t ScreenY) {
+
+  if (wake()) {
+    return -1;
+  }
+
+  MENU_PROBE(PROF_PRESS);
+
+  MenuHit hit;
+
+  // the keypad takes the taps that land on it
+  if ((kp.w > 0) && (ScreenX >= kp.x) && (ScreenX < (kp.x + kp.w)) && (ScreenY >= kp.y) && (ScreenY < (kp.y + kp.h))) {
+    pressKey(min(2, ((ScreenX - kp.x) * 3) / kp.w) + (3 * min(3, ((ScreenY - kp.y) * 4) / kp.h)));
+    return -1;
+  }
+
+  if (!hitTest(ScreenX, ScreenY, hit)) {
+    return -1;
+  }
+
+  if (hit.zone == ZONE_UPARROW) {
+    // up arrow
+    MoveDown();
+    return -1;
+  }
+
+  if (hit.zone == ZONE_DOWNARROW) {
+    // down arrow
+    MoveUp();
+    return -1;
+  }
+
+  if (hit.zone == ZONE_HEADER) {
+    // above will allow arrow up down but
+    // let's not allow menu exit until they are done editing the line item
+    if (rowselected) {
+      return - 1;
+    }
+    // not up / down and nothing selected, allow menu exit
+    if (store) {
+      save();
+    }
+    return 0;
+  }
+
+  // icons sit left of the menu bar and are not part of the row
+  if ((hit.zone == ZONE_ICON) || (!enablestate[hit.id])) {
+    return -1;
+  }
+
+  delay(100);
+  if (rowselected) {
+    if (hit.row == cr) {
+      if (digitEdit(hit.id)) {
+        endDigits();
+      }
+      rowselected = !rowselected;
+      closeKeypad();
+      item = hit.id;
+      cr = hit.row;
+      currentID = hit.id;
+      return currentID;
+    }
+  }
+  else if (itemKind(hit.id) == ITEM_TOGGLE) {
+    // flips without an edit, drawRow shows it
+    currentID = hit.id;
+    cr = hit.row;
+    flip(currentID);
+    return currentID;
+  }
+  else {
+    rowselected = !rowselected;
+    currentID = hit.id;
+    cr = hit.row;
+    dp = digitTop(currentID);
+    if (digitEdit(currentID) && enabletouch) {
+      openKeypad();
+    }
+    return currentID;
+  }
+
+  return -1;
+}
+
+bool EditMenu::hitTest(int16_t ScreenX, int16_t ScreenY, MenuHit &Hit) {
+
+  int bs, off, hr;
+
+  Hit.row = -1;
+  Hit.id = -1;
+  Hit.zone = ZONE_NONE;
+
+  // check if header pressed
+  if (  (ScreenX > tbl) && (ScreenX < (tbw + tbl))  &&  (ScreenY > tbt ) && (ScreenY < (tbt + tbh) )) {
+    Hit.row = 0;
+    Hit.id = 0;
+    if (ScreenX < (tbl + huw)) {
+      Hit.zone = ZONE_UPARROW;
+    }
+    else if (ScreenX > (tbl + tbw - hdw)) {
+      Hit.zone = ZONE_DOWNARROW;
+    }
+    else {
+      Hit.zone = ZONE_HEADER;
+    }
+    return true;
+  }
+
+  // rows are all irh high so the row comes straight from the y offset
+  off = ScreenY - isy;
+  if ((off <= -slop) || (off >= (irh * imr) + slop)) {
+    return false;
+  }
+  if (slop == 0) {
+    // no slop, the line between two rows belongs to neither
+    if ((off % irh) == 0) {
+      return false;
+    }
+  }
+  else {
+    off = constrain(off, 0, (irh * imr) - 1);
+  }
+
+  hr = (off / irh) + 1;
+  if ((hr + sr) > totalID) {
+    return false;
+  }
+
+  bs = icox + iconW(hr + sr) + isx;
+
+  if ((iconType(hr + sr) != ICON_NONE) && (ScreenX >= icox) && (ScreenX < (icox + iconW(hr + sr)))) {
+    Hit.zone = ZONE_ICON;
+  }
+  else if ((ScreenX > (bs - slop)) && (ScreenX < (irw + slop))) {
+    if (ScreenX >= col) {
+      Hit.zone = ZONE_VALUE;
+    }
+    else {
+      Hit.zone = ZONE_LABEL;
+    }
+  }
+  else {
+    return false;
+  }
+
+  Hit.row = hr;
+  Hit.id = hr + sr;
+  return true;
+
+}
+
+void EditMenu::setTouchSlop(uint8_t Slop) {
+  slop = Slop;
+}
+
+void EditMenu::setHeaderZones(uint16_t UpArrowWidth, uint16_t DownArrowWidth) {
+  huw = UpArrowWidth;
+  hdw = DownArrowWidth;
+}
+
+void EditMenu::setScrollPhysics(uint8_t DragThreshold, uint16_t Deceleration) {
+  scroll.threshold = DragThreshold;
+  scroll.decel = Deceleration;
+}
+
+int EditMenu::touch(int16_t ScreenX, int16_t ScreenY, uint8_t Event) {
+
+  if (wake() || waking) {
+    // the touch that woke the menu goes no further, up to its release
+    waking = (Event != TOUCH_UP);
+    return -1;
+  }
+
+  if (Event == TOUCH_DOWN) {
+    tx = ScreenX;
+    ty = ScreenY;
+    // a touch during a flick just stops it
+    caught = scroll.flinging;
+    if (caught) {
+      settleScroll();
+    }
+    // no scrolling the list while a value is being edited
+    if ((rowselected) || (totalID <= imr) || (ScreenY < isy)) {
+      scroll.press(ScreenY, sr * irh, sr * irh, sr * irh);
+    }
+    else {
+      scroll.press(ScreenY, sr * irh, (totalID - imr) * irh);
+    }
+    return -1;
+  }
+
+  if (Event == TOUCH_MOVE) {
+    if (scroll.move(ScreenY)) {
+      if (fr.period > 0) {
+        pendscroll = true;
+        fr.request();
+      }
+      else {
+        drawScroll();
+      }
+    }
+    return -1;
+  }
+
+  if (scroll.release()) {
+    if (!scroll.flinging) {
+      settleScroll();
+    }
+    return -1;
+  }
+
+  if (caught) {
+    return -1;
+  }
+
+  // not a drag so it's a tap
+  return press(tx, ty);
+
+}
+
+bool EditMenu::updateScroll() {
+
+  if ((!scroll.flinging) || idle) {
+    return false;
+  }
+  if (scroll.step()) {
+    if (fr.period > 0) {
+      pendscroll = true;
+      fr.request();
+    }
+    else {
+      drawScroll();
+    }
+  }
+  if (!scroll.flinging) {
+    settleScroll();
+  }
+  return true;
+
+}
+
+void EditMenu::drawScroll() {
+
+  const void *bits;
+  uint16_t sw, sx, sy;
+  byte type;
+  MENU_PROBE(PROF_SCROLL);
+
+  int16_t x0 = view.w ? icox : min(icox, isx);  // leftmost pixel a row draws to
+  int16_t y, y0, y1;
+  int k, id, first, po, bs;
+  uint16_t tc;
+
+  if (!strip) {
+    strip = new GFXcanvas1(irw - x0, irh);
+  }
+  if ((!strip) || (!strip->getBuffer())) {
+    return;
+  }
+
+  first = scroll.pos / irh;
+  po = scroll.pos % irh;
+
+  strip->setFont(itemf);
+  strip->setTextWrap(false);
+  vid = 0;
+
+  // one more row than fits since the top and bottom rows can be part way off
+  for (k = 0; k <= imr; k++) {
+
+    id = first + k + 1;
+    y = isy + (k * irh) - po;
+    y0 = max(y, (int16_t) isy);
+    y1 = min((int16_t) (y + irh), (int16_t) (isy + (imr * irh)));
+    if (y1 <= y0) {
+      continue;
+    }
+
+    strip->fillScreen(0);
+    touched(x0, y0, irw - x0, y1 - y0);
+
+    if (id > totalID) {
+      blitStrip(tft, cv, strip, x0, y, y0 - y, y1 - y0, ibc, ibc, ICON_NONE, nullptr, 0, 0, 0, 0, 0, 0, 0, 0);
+      continue;
+    }
+
+    bs = icox + iconW(id) + isx;
+    tc = enablestate[id] ? itc : ditc;
+
+    strip->setCursor(bs + iox - x0, ioy);
+    printLabel(strip, id);
+    strip->setCursor(col - x0, ioy);
+    printValue(strip, id, 1);
+
+    type = iconSheet(id, bits, sw, sx, sy);
+    blitStrip(tft, cv, strip, x0, y, y0 - y, y1 - y0, tc, ibc, type, bits, sw, sx, sy,
+              icox - x0, icoy, iconW(id), iconH(id), itc);
+  }
+
+  sr = first;
+
+}
+
+void EditMenu::settleScroll() {
+
+  // snap to the nearest whole row
+  sr = (scroll.pos + (irh / 2)) / irh;
+  scroll.pos = sr * irh;
+  scroll.flinging = false;
+  pendscroll = false;
+  drawScroll();
+
+  if ((currentID > 0) && ((currentID <= sr) || (currentID > (sr + imr)))) {
+    currentID = sr + 1;
+  }
+  if (currentID > 0) {
+    cr = currentID - sr;
+    // the strips are drawn plain, the current row gets its highlight back
+    paintRow(currentID);
+  }
+  pr = cr;
+
+}
+
+void EditMenu::up() {
+
+  int n;
+
+  cr--;
+  currentID--;
+  update();
+  // at most one lap, the header may be disabled too
+  for (n = 0; (enablestate[currentID] == false) && (n < totalID); n++) {
+    cr--;
+    currentID--;
+    update();
+  }
+}
+
+void EditMenu::down() {
+
+  int n;
+
+  cr++;
+  currentID++;
+  update();
+  // at most one lap, the header may be disabled too
+  for (n = 0; (enablestate[currentID] == false) && (n < totalID); n++) {
+    cr++;
+    currentID++;
+    update();
+  }
+}
+
+void EditMenu::update() {
+
+  if (fr.period == 0) {
+    drawItems();
+    return;
+  }
+
+  // frame rate set, just move and let tick() draw
+  scrollItems();
+  pendredraw = pendredraw || redraw;
+  pendnav = true;
+  fr.request();
+
+}
+
+void EditMenu::setFrameRate(uint8_t FramesPerSecond) {
+  fr.setRate(FramesPerSecond);
+  clearPending();
+}
+
+void EditMenu::clearPending() {
+  fr.pending = false;
+  pendnav = false;
+  pendredraw = false;
+  pendscroll = false;
+  pendval = -1;
+  memset(pendrow, 0, sizeof(pendrow));
+}
+
+const MenuFrames &EditMenu::getFrameStats() {
+  return fr;
+}
+
+// goes idle after Timeout ms with no input, 0 never, Hook is called with true once the display
+// is off and with false when it is back, for a backlight or to let the sketch sleep the MCU
+void EditMenu::setIdle(uint32_t Timeout, uint8_t Mode, void (*Hook)(bool Idle)) {
+  idlems = Timeout;
+  idlemode = Mode;
+  idlehook = Hook;
+  lastinput = millis();
+}
+
+bool EditMenu::isIdle() {
+  return idle;
+}
+
+const MenuIdleStats &EditMenu::getIdleStats() {
+  return ist;
+}
+
+// one line of memoryReport, the field and its bytes
+static void memLine(Print &Out, const __FlashStringHelper *Name, size_t Bytes) {
+  Out.print(Name);
+  Out.print(' ');
+  Out.println((unsigned long) Bytes);
+}
+
+#define MENU_MEM(f)	memLine(Out, F(#f), sizeof(f)); n += sizeof(f)
+
+// RAM a menu object takes field by field as built (MAX_OPT, MAX_CHAR_LEN, MENU_ITEM_RAM), no menu
+// needed, the arrays that grow with MAX_OPT come first, strip is allocated the first time a touch
+// menu is dragged and is not in the total
+void EditMenu::memoryReport(Print &Out) {
+
+  size_t n = 0;
+
+  Out.print(F("EditMenu "));
+  Out.println((unsigned long) sizeof(EditMenu));
+  MENU_MEM(value);
+#if MENU_ITEM_RAM
+  MENU_MEM(itemlabel);
+  MENU_MEM(low);
+  MENU_MEM(high);
+  MENU_MEM(inc);
+  MENU_MEM(dec);
+  MENU_MEM(itemtext);
+  MENU_MEM(haslist);
+  MENU_MEM(kind);
+  MENU_MEM(itemBitmap);
+  MENU_MEM(item565Bitmap);
+  MENU_MEM(bmp_w);
+  MENU_MEM(bmp_h);
+  MENU_MEM(IconType);
+#endif
+  MENU_MEM(rlabel);
+  MENU_MEM(enablestate);
+  MENU_MEM(pendrow);
+  MENU_MEM(saved);
+  MENU_MEM(aicon);
+#if MENU_BIND
+  MENU_MEM(bound);
+  MENU_MEM(boundtype);
+#endif
+  MENU_MEM(ival);
+  memLine(Out, F("per item"), n / MAX_OPT);
+  MENU_MEM(ttx);
+  MENU_MEM(etx);
+  MENU_MEM(vtx);
+  MENU_MEM(dmg);
+  MENU_MEM(scroll);
+  MENU_MEM(fr);
+  memLine(Out, F("other"), sizeof(EditMenu) - n);
+
+}
+
+// puts the menu in the W x H rectangle at X, Y and keeps it there, the title bar takes the top
+// of it and the layout moves over with its margins kept, rows that no longer fit are dropped,
+// call it after the other layout setters and before draw
+void EditMenu::setViewport(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  int16_t rm = tbl + tbw - irw;  // right margin of the rows
+  int16_t fit;
+
+  isy += Y - tbt;
+  icox += X - tbl;
+  col += X - tbl;
+  tbl = X;
+  tbt = Y;
+  tbw = W;
+  irw = X + W - rm;
+
+  fit = max((Y + H - (int16_t) isy) / (int16_t) irh, 0);
+  if (fit < imr) {
+    imr = fit;
+  }
+
+  view.x = X;
+  view.y = Y;
+  view.w = W;
+  view.h = H;
+
+  dropStrip();
+
+}
+
+// rectangles drawn since clearDamage, merged once there are more than MENU_DAMAGE of them
+uint8_t EditMenu::getDamage(const MenuRect *&Rects) {
+  Rects = dmg;
+  return ndmg;
+}
+
+void EditMenu::clearDamage() {
+  ndmg = 0;
+}
+
+// draws into Canvas from now on, flush it to put the menu on the panel, nullptr draws on the panel again
+void EditMenu::setCanvas(MenuCanvas *Canvas) {
+  cv = Canvas;
+  d = Canvas ? (Adafruit_GFX *) Canvas : tft;
+}
+
+// draw() records into List and only what changed since the last draw goes out, make the list
+// with the same canvas as the menu, nullptr draws straight away again
+void EditMenu::setList(MenuList *List) {
+  ls = List;
+}
+
+// the title text cut at the end of the title bar inside a viewport
+void EditMenu::printTitle(const char *Text) {
+
+  if (view.w == 0) {
+    d->print(Text);
+    return;
+  }
+  d->write((const uint8_t *) Text, textFit(titlef, nullptr, Text, tbl + tbw - d->getCursorX()));
+
+}
+
+// notes a rectangle about to be drawn, the part on the screen goes in the damage list
+void EditMenu::touched(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  MenuRect r;
+
+  r.x = max(X, (int16_t) 0);
+  r.y = max(Y, (int16_t) 0);
+  r.w = min((int16_t) (X + W), d->width()) - r.x;
+  r.h = min((int16_t) (Y + H), d->height()) - r.y;
+  if ((r.w > 0) && (r.h > 0)) {
+    addDamage(dmg, ndmg, r);
+  }
+  if ((ls) && (d != ls)) {
+    // drawn past the list, the screen no longer shows its last draw
+    ls->invalidate();
+  }
+
+}
+
+void EditMenu::goIdle() {
+
+  uint32_t t0 = micros();
+
+  idle = true;
+  // a frame still waiting goes out with the wake
+  stale = fr.pending;
+  if (cv) {
+    cv->drain();
+  }
+  tft->enableDisplay(false);
+  if (idlemode == IDLE_SLEEP) {
+    tft->enableSleep(true);
+  }
+  ist.entries++;
+  ist.enterus = micros() - t0;
+  if (idlehook) {
+    idlehook(true);
+  }
+
+}
+
+// counts as input, and when idle brings the display back, the panel kept its picture so it
+// is only redrawn if something was drawn or changed while idle, returns true if the menu was
+// idle so the input that woke it can be dropped
+bool EditMenu::wake() {
+
+  uint32_t t0, t;
+
+  lastinput = millis();
+  if (!idle) {
+    return false;
+  }
+
+  t0 = micros();
+  idle = false;
+  if (cv) {
+    cv->drain();
+  }
+  if (idlemode == IDLE_SLEEP) {
+    tft->enableSleep(false);
+    // sleep out needs 5 ms before the next command
+    delay(5);
+  }
+  if (stale || fr.pending) {
+    draw();
+  }
+  stale = false;
+  if (cv) {
+    // the panel comes back with the frame it missed
+    cv->flush();
+    cv->drain();
+  }
+  tft->enableDisplay(true);
+  t = micros() - t0;
+  ist.wakeus = t;
+  if (t > ist.maxwakeus) {
+    ist.maxwakeus = t;
+  }
+  if (idlehook) {
+    idlehook(false);
+  }
+  return true;
+
+}
+
+bool EditMenu::tick() {
+
+  MENU_PROBE(PROF_TICK);
+
+  int id;
+
+  if ((unsaved) && (idlesave > 0) && ((millis() - lastedit) >= idlesave)) {
+    save();
+  }
+
+  if (idle) {
+    return false;
+  }
+  if ((idlems > 0) && ((millis() - lastinput) >= idlems)) {
+    goIdle();
+    return false;
+  }
+
+  updateScroll();
+
+  if (!fr.due()) {
+    return false;
+  }
+
+  if (pendscroll) {
+    drawScroll();
+  }
+
+  // all the moves since the last frame go out as one
+  if ((pendnav) && (enablestate[currentID])) {
+    redraw = pendredraw;
+    paintItems();
+  }
+
+  for (id = 0; id <= totalID; id++) {
+    if (pendrow[id]) {
+      paintRow(id);
+      pendrow[id] = false;
+      if (id == pendval) {
+        pendval = -1;
+      }
+    }
+  }
+
+  // the value is only drawn for the row it was edited in
+  if ((pendval > 0) && (pendval == currentID)) {
+    paintValue();
+  }
+
+  pendnav = false;
+  pendredraw = false;
+  pendscroll = false;
+  pendval = -1;
+  fr.drawn();
+  return true;
+
+}
+
+
+void EditMenu::setHighlightSlide(uint8_t Steps, uint16_t Millis) {
+  slides = Steps;
+  slidems = Millis;
+}
+
+// an atlas past 0xFF or MENU_GLYPHS glyphs is not taken
+void EditMenu::setGlyphs(const MenuGlyphs *Glyphs) {
+  glyphs = glyphsFit(Glyphs) ? Glyphs : nullptr;
+}
+
+void EditMenu::setIconAtlas(const MenuIconAtlas *Atlas) {
+  atlas = Atlas;
+}
+
+void EditMenu::setItemIcon(int ID, uint8_t Icon) {
+  if ((ID < 1) || (ID >= MAX_OPT)) return;
+  aicon[ID] = Icon;
+}
+
+// moves the highlight bar from row From to row To in slides steps, each step only repaints
+// the band the bar leaves and the band it covers, a step that runs past its share of slidems
+// makes the next one the last
+void EditMenu::slideBar(int From, int To) {
+
+  int16_t x0 = view.w ? icox : min(icox, isx);
+  int16_t y0 = isy - irh + (irh * From);
+  int16_t y1 = isy - irh + (irh * To);
+  int16_t yb = y0, yn;
+  uint32_t t0 = millis(), due, now;
+  int k;
+
+  if (!strip) {
+    strip = new GFXcanvas1(irw - x0, irh);
+  }
+  if ((!strip) || (!strip->getBuffer())) {
+    return;
+  }
+
+  // the bar loses its border and arrows while it moves
+  paintBand(y0, y0 + irh, true);
+
+  for (k = 1; k <= slides; k++) {
+    yn = y0 + (((int32_t) (y1 - y0) * k) / slides);
+    if (yn > yb) {
+      paintBand(yb, min(yn, (int16_t) (yb + irh)), false);
+      paintBand(max((int16_t) (yb + irh), yn), yn + irh, true);
+    }
+    else if (yn < yb) {
+      paintBand(yn, min((int16_t) (yn + irh), yb), true);
+      paintBand(max((int16_t) (yn + irh), yb), yb + irh, false);
+    }
+    yb = yn;
+
+    if (k == slides) {
+      break;
+    }
+    due = ((uint32_t) slidems * k) / slides;
+    now = millis() - t0;
+    if (now < due) {
+      delay(due - now);
+    }
+    else {
+      k = slides - 1;
+    }
+  }
+
+}
+
+// repaints rows Y0 to Y1 of the list, the part of each row right of its icon, as highlight or not
+void EditMenu::paintBand(int16_t Y0, int16_t Y1, bool hl) {
+
+  int16_t x0 = view.w ? icox : min(icox, isx);
+  int16_t top, a, b;
+  int r, id, bs;
+  uint16_t tc;
+
+  strip->setFont(itemf);
+  strip->setTextWrap(false);
+
+  for (r = 1; r <= imr; r++) {
+    top = isy - irh + (irh * r);
+    a = max(Y0, top);
+    b = min(Y1, (int16_t) (top + irh));
+    if (b <= a) {
+      continue;
+    }
+    id = r + sr;
+    bs = icox + iconW(id) + isx;
+    tc = enablestate[id] ? itc : ditc;
+
+    strip->fillScreen(0);
+    strip->setCursor(bs + iox - x0, ioy);
+    printLabel(strip, id);
+    strip->setCursor(col - x0, ioy);
+    printValue(strip, id, 1);
+
+    blitBand(tft, cv, strip, x0, top, bs - x0, a - top, b - a, hl ? ihtc : tc, hl ? ihbc : ibc);
+    touched(bs, a, irw - bs, b - a);
+  }
+
+}
+
+void EditMenu::MoveUp() {
+
+  if (wake()) {
+    return;
+  }
+
+  if (digitEdit(currentID)) {
+    editDigit(-1, 1);
+    showValue();
+    delay(incdelay);
+  }
+  else if (rowselected) {
+    incrementUp();
+  }
+  else {
+    up();
+  }
+
+}
+
+void EditMenu::MoveDown() {
+
+  if (wake()) {
+    return;
+  }
+
+  if (digitEdit(currentID)) {
+    editDigit(-1, -1);
+    showValue();
+    delay(incdelay);
+  }
+  else if (rowselected) {
+    incrementDown();
+  }
+  else {
+    down();
+  }
+}
+
+
+
+void EditMenu::draw() {
+
+  int id;
+  int8_t k;
+#if MENU_BIND
+  float v;
+  int32_t n;
+#endif
+
+  if (idle) {
+    stale = true;
+    return;
+  }
+  lastinput = millis();
+
+  // a full draw lands a flick on a whole row first
+  if (scroll.flinging) {
+    settleScroll();
+  }
+
+  for (id = 1; id <= totalID; id++) {
+#if MENU_BIND
+    if ((boundtype[id] != BIND_NONE) && readBound(id, v, n)) {
+      value[id] = v;
+      ival[id] = n;
+    }
+#endif
+    // the sketch may have set value[] of a typed item
+    syncInt(id);
+  }
+
+  if (ls) {
+    d = ls;
+    ls->begin();
+  }
+  drawHeader(false, 0);
+  drawItems();
+  if (kp.w > 0) {
+    // the key last pressed stays lit
+    k = kkey;
+    openKeypad();
+    if (k >= 0) {
+      paintKey(k, true);
+      kkey = k;
+    }
+  }
+  if (ls) {
+    ls->end();
+    d = cv ? (Adafruit_GFX *) cv : tft;
+  }
+  // everything is on screen now
+  clearPending();
+}
+
+void EditMenu::drawItems() {
+
+  scrollItems();
+
+  if (enablestate[currentID] == false) {
+    return;
+  }
+
+  paintItems();
+
+}
+
+void EditMenu::scrollItems() {
+
+  if (imr > totalID) {
+    imr = totalID;
+  }
+  redraw = false;
+  // determine if we need to pan or just increment the list
+
+  if ((currentID >  totalID) && (sr >= 0) ) {
+    // up to top
+    cr = 0;
+    currentID = 0;
+    sr = 0;
+    redraw = true;
+  }
+  else if ((cr < 0) || (currentID < 0)) {
+    //  pan whole menu to bottom, up from the header lands here even if the list was scrolled
+    cr = imr;
+    currentID = totalID;
+    sr = totalID - imr;
+    redraw = true;
+  }
+  else if ( (cr > imr) && ((sr + cr) > totalID) ) {
+    //  pan whole menu to top
+    cr = 1;
+    currentID = 1;
+    sr = 0;
+    redraw = true;
+  }
+  else if ((cr > imr) && (sr >= 0))   {
+    // scroll whole list up one by one
+    sr++;
+    cr = imr;
+    redraw = true;
+  }
+  else if ((cr < 1) && (sr > 0))   {
+    // scroll whole list down one by one
+    sr--;
+    cr = 1;
+    redraw = true;
+  }
+
+}
+
+void EditMenu::paintItems() {
+
+  MENU_PROBE(PROF_ITEMS);
+
+  int  bs;
+
+  // determine if we need arrows
+  if (cr == imr) {
+    moredown = true;
+  }
+  if (cr == 1) {
+    moreup = true;
+  }
+
+  // determine if we need to redraw the header and draw
+  if ((currentID == 0) && (cr == 0)) {
+    drawHeader(true, 0);
+    redrawh = true;
+  }
+  else if ((pr == 0) && (cr > 0)) {
+    if (redrawh) {
+      redrawh = false;
+      drawHeader(false, 0);
+    }
+  }
+
+  if ((slides > 0) && (fr.period == 0) && (!redraw) && (!enabletouch) && (d != ls) && (pr > 0) && (cr > 0) && (pr != cr) &&
+      (pr <= imr) && (cr <= imr)) {
+    slideBar(pr, cr);
+  }
+
+  d->setFont(itemf);
+  vid = 0;
+
+  // now draw the items in the rows
+  for (i = 1; i <= imr; i++) {
+    // menu bar start
+    bs = icox + iconW(i + sr) + isx;
+
+    // text start
+    itx = bs + iox;
+    touched(icox, isy - irh + (irh * i), irw - icox, irh);
+
+    if (enablestate[i + sr]) {
+      temptColor = itc;
+    }
+    else {
+      temptColor = ditc;
+    }
+
+    if (redraw) {
+      // scroll so blank out every row including icon since row will get scrolled
+      fill(d, icox, isy - irh + (irh * i), irw - icox, irh, ibc); // back color
+    }
+
+    if (i == pr) {
+      // maybe just row change so blank previous
+      fill(d, bs, isy - irh + (irh * pr) , irw - bs, irh, ibc); // back color
+    }
+
+    if ((i == cr) && rowselected) {
+
+      // row being edited, same as paintRow draws it
+      if (radius > 0) {
+        fillRound(d, bs,      isy - irh + (irh * i) ,      irw - bs,       irh,        radius,   sbcolor);
+        fillRound(d, bs + thick,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick),  irh - (2 * thick),  radius,   isbc);
+      }
+      else {
+        fill(d, bs,       isy - irh + (irh * i) ,      irw - bs  ,        irh, sbcolor);
+        fill(d, bs + thick ,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick) , irh - (2 * thick), isbc);
+      }
+      temptColor = istc;
+
+    }
+    else if ((i == cr) && (!enabletouch)) {
+
+      if (radius > 0) {
+        fillRound(d, bs,      isy - irh + (irh * i) ,      irw - bs,       irh,        radius,   bcolor);
+        fillRound(d, bs + thick,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
+      }
+      else {
+        fill(d, bs,       isy - irh + (irh * i) ,      irw - bs  ,        irh, bcolor);
+        fill(d, bs + thick ,  isy - irh + (irh * i) + thick, irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
+      }
+
+      if (moreup) {
+        d->fillTriangle(irw - 8 - thick,              isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
+                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + (irh / TRIANGLE_H),
+                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + irh - (irh / TRIANGLE_H), ihtc);
+      }
+      if (moredown) {
+        d->fillTriangle(irw - 8 - thick,                 isy - irh + (irh * i) + (irh / TRIANGLE_H),
+                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * i) + irh - (irh / TRIANGLE_H),
+                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * i) + (irh / TRIANGLE_H),     ihtc);
+      }
+      temptColor = ihtc;
+
+    }
+
+    // write bitmap
+
+    if (iconType(i + sr) == ICON_MONO) {
+      drawMonoBitmap(icox,  icoy + isy - irh + (irh * i), monoBitmap(i + sr), iconW(i + sr), iconH(i + sr), itc );
+    }
+    else if (iconType(i + sr) == ICON_565) {
+      draw565Bitmap(icox,  icoy + isy - irh + (irh * i), colorBitmap(i + sr), iconW(i + sr), iconH(i + sr) );
+    }
+    else if (iconType(i + sr) == ICON_PACKED) {
+      drawPackedBitmap(icox,  icoy + isy - irh + (irh * i), monoBitmap(i + sr), iconW(i + sr), iconH(i + sr) );
+    }
+    else if (iconType(i + sr) == ICON_ATLAS) {
+      drawAtlasIcon(icox,  icoy + isy - irh + (irh * i), i + sr, itc);
+    }
+
+    // write text
+    d->setTextColor(temptColor);
+    d->setCursor(itx , isy - irh + (irh * i) + ioy);
+    printLabel(d, i + sr);
+
+    // write new val
+    d->setCursor(col , isy - irh + (irh * i) + ioy);
+    printValue(d, i + sr, temptColor);
+
+    if ((i == cr) && digitEdit(i + sr)) {
+      valueText(vtx, i + sr);
+      paintDigit(vtx, isy - irh + (irh * i));
+    }
+
+  }
+
+  moreup = false;
+  moredown = false;
+  pr = cr;
+
+}
+
+void EditMenu::drawRow(int ID) {
+
+  if (idle) {
+    stale = true;
+    return;
+  }
+
+  if (fr.period == 0) {
+    paintRow(ID);
+    return;
+  }
+  if ((ID >= 0) && (ID <= totalID)) {
+    pendrow[ID] = true;
+    fr.request();
+  }
+
+}
+
+void EditMenu::paintRow(int ID) {
+
+  MENU_PROBE(PROF_ROW);
+
+  int  bs;
+  int hr = ID - sr;
+  bool drawarrow = false;
+
+  uint16_t textcolor, backcolor, sbackcolor;
+
+  moredown = false;
+  moreup = false;
+
+  // compute starting place for text
+  itx = isx + icox +  iconW(ID);
+  textcolor = itc;
+
+  if (ID == 0) {
+    drawHeader(false, rowselected);
+  }
+
+  if (ID <= 0) {
+    return;
+  }
+
+  bs = icox + iconW(ID) + isx;
+
+  if (ID <= sr) {
+    // item is off screen
+    return;
+  }
+
+  if (ID > (sr + imr)) {
+    // item is off screen
+    return;
+  }
+
+  if (enabletouch) {
+
+    if (ID == currentID) {
+      if (!rowselected) {
+        textcolor = itc;
+        backcolor = ibc;
+	    sbackcolor = ibc;
+      }
+      else {
+        // case draw row is the selected row
+        textcolor = istc;
+        backcolor = isbc;
+	    sbackcolor = sbcolor;
+      }
+    }
+    else {
+      // case draw row is not the selected row
+      textcolor = itc;
+      backcolor = ibc;
+      sbackcolor = ibc;
+    }
+
+  }
+  else {
+    if ((cr + sr) == ID) {
+
+      if (!rowselected) {
+        // case 1 draw som is draw row AND highlighted
+        textcolor = ihtc;
+        backcolor = ihbc;
+	sbackcolor = bcolor;
+        drawarrow = true;
+
+      }
+      else if (rowselected) {
+        // case 2 = current row is draw row AND highlighted
+        textcolor = istc;
+        backcolor = isbc;
+	sbackcolor = sbcolor;
+        drawarrow = false;
+
+      }
+    }
+    else  {
+      // current row is not selected
+      if (enablestate[ID]) {
+        textcolor = itc;
+      }
+      else {
+        textcolor = ditc;
+      }
+      backcolor = ibc;
+      sbackcolor = ibc;
+      drawarrow = false;
+    }
+  }
+
+  // same arrows as paintItems, only the highlighted row has them
+  if (cr == imr) {
+    moredown = true;
+  }
+  if (cr == 1) {
+    moreup = true;
+  }
+
+  if (enabletouch) {
+    drawarrow = false;
+  }
+
+  if (ID == 0) {
+    if (rowselected) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ttc);
+      d->print(ttx);
+    }
+    else {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      d->print(ttx);
+    }
+  }
+  else {
+
+    touched(icox, isy - irh + (irh * hr), irw - icox, irh);
+
+    if (!enabletouch) {
+      // non touch
+      if (radius > 0) {
+        fillRound(d, bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   sbackcolor);
+        fillRound(d, bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   backcolor);
+      }
+      else {
+        fill(d, bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, sbackcolor);
+	fill(d, bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  backcolor);
+      }
+    }
+
+    else {
+      // touch
+      if (rowselected) {
+
+        if (radius > 0) {
+          fillRound(d, bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   sbackcolor);
+          fillRound(d, bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   backcolor);
+        }
+        else {
+          fill(d, bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, sbackcolor);
+	  fill(d, bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  backcolor);
+        }
+
+      }
+      else {
+
+        fill(d, bs, isy - irh + (irh * hr) , irw - bs, irh, ibc); // back color
+
+      }
+    }
+    if (!enablestate[ID]) {
+      textcolor = ditc;
+    }
+    // write text
+    itx = bs + iox;
+    d->setFont(itemf);
+    d->setTextColor(textcolor);
+    d->setCursor(itx , isy - irh + (irh * hr) + ioy);
+    printLabel(d, ID);
+
+    d->setCursor(col , isy - irh + (irh * (ID - sr)) + ioy);
+    printValue(d, ID, textcolor);
+    if ((ID == currentID) && rowselected) {
+      valueText(vtx, ID);
+      vid = ID;
+      dcw = 0;
+      paintDigit(vtx, isy - irh + (irh * hr));
+    }
+    else if (ID == vid) {
+      vid = 0;
+    }
+
+    // write bitmap
+    if (iconType(ID) == ICON_MONO) {
+      drawMonoBitmap(icox,  icoy + isy - irh + (irh * (ID - sr)), monoBitmap(ID), iconW(ID), iconH(ID), itc );
+    }
+    else if (iconType(ID) == ICON_565) {
+      draw565Bitmap(icox,  icoy + isy - irh + (irh * (ID - sr)), colorBitmap(ID), iconW(ID), iconH(ID) );
+    }
+    else if (iconType(ID) == ICON_PACKED) {
+      drawPackedBitmap(icox,  icoy + isy - irh + (irh * (ID - sr)), monoBitmap(ID), iconW(ID), iconH(ID) );
+    }
+    else if (iconType(ID) == ICON_ATLAS) {
+      drawAtlasIcon(icox,  icoy + isy - irh + (irh * (ID - sr)), ID, itc);
+    }
+
+    if (drawarrow) {
+      if (moreup) {
+        d->fillTriangle(irw - 8 - thick,              isy - irh + (irh * hr) + irh - (irh / TRIANGLE_H),
+                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * hr) + (irh / TRIANGLE_H),
+                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * hr) + irh - (irh / TRIANGLE_H), ihtc);
+      }
+      if (moredown) {
+        d->fillTriangle(irw - 8 - thick,                 isy - irh + (irh * hr) + (irh / TRIANGLE_H),
+                        irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * hr) + irh - (irh / TRIANGLE_H),
+                        irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * hr) + (irh / TRIANGLE_H),     ihtc);
+      }
+    }
+
+  }
+
+  moreup = false;
+  moredown = false;
+
+}
+
+void EditMenu::setIncrementDelay(uint16_t Delay) {
+
+  incdelay = Delay;
+
+}
+
+void EditMenu::incrementUp() {
+
+  MENU_PROBE(PROF_INCREMENT);
+
+  lastedit = millis();
+  unsaved = true;
+
+  if (itemKind(currentID) != ITEM_FLOAT) {
+    stepInt(currentID, 1);
+  }
+  else if (hasList(currentID)) {
+    if ((value[currentID] + increment(currentID)) < highLimit(currentID)) {
+      value[currentID] += increment(currentID);
+    }
+    else {
+      value[currentID] = lowLimit(currentID);
+    }
+  }
+  else {
+    value[currentID] += increment(currentID);
+    if (value[currentID] > highLimit(currentID)) {
+      value[currentID] = lowLimit(currentID);
+    }
+  }
+
+  writeBound(currentID);
+
+  if (fr.period > 0) {
+    pendval = currentID;
+    fr.request();
+  }
+  else {
+    paintValue();
+  }
+
+  delay(incdelay);
+  item = currentID;
+}
+
+void EditMenu::incrementDown() {
+
+  MENU_PROBE(PROF_INCREMENT);
+
+  lastedit = millis();
+  unsaved = true;
+
+  if (itemKind(currentID) != ITEM_FLOAT) {
+    stepInt(currentID, -1);
+  }
+  else if (hasList(currentID)) {
+    if ((value[currentID] - increment(currentID)) >= lowLimit(currentID)) {
+      value[currentID] -= increment(currentID);
+    }
+    else {
+      value[currentID] = highLimit(currentID) - 1;
+    }
+  }
+  else {
+    value[currentID] -= increment(currentID);
+    if (value[currentID] < lowLimit(currentID)) {
+      value[currentID] = highLimit(currentID);
+    }
+  }
+
+  writeBound(currentID);
+
+  if (fr.period > 0) {
+    pendval = currentID;
+    fr.request();
+  }
+  else {
+    paintValue();
+  }
+
+  delay(incdelay);
+  item = currentID;
+
+}
+
+// redraws the value of the row being edited
+void EditMenu::paintValue() {
+
+  MENU_PROBE(PROF_VALUE);
+
+  char buf[MAX_CHAR_LEN];
+  int16_t y = isy - irh + (irh * cr);
+
+  if ((currentID < 1) || (cr < 1)) {
+    return;
+  }
+
+  d->setFont(itemf);
+  d->setTextColor(istc);
+  valueText(buf, currentID);
+
+  if (vid == currentID) {
+    // the cell knows what is on screen, only touch what changed
+    if (dcw > 0) {
+      fill(d, dcx, y + irh - thick - 2, dcw, 2, isbc);
+      touched(dcx, y + irh - thick - 2, dcw, 2);
+    }
+    paintCell(vtx, buf, y, isbc);
+    strcpy(vtx, buf);
+    paintDigit(buf, y);
+    return;
+  }
+
+  fill(d, col, y + thick, irw - col - (2 * thick), irh - (2 * thick), isbc);
+  touched(col, y + thick, irw - col - (2 * thick), irh - (2 * thick));
+  touched(icox, y + icoy, iconW(currentID), iconH(currentID));
+  // as printValue draws it, valueText has already cut it to a viewport
+  d->setCursor(valueX(buf), y + ioy);
+  printText(d, itemf, glyphs, buf, strlen(buf));
+  strcpy(vtx, buf);
+  vid = currentID;
+  dcw = 0;
+  paintDigit(buf, y);
+
+  if (iconType(currentID) == ICON_MONO) {
+    drawMonoBitmap(icox,  icoy + isy - irh + (irh * cr), monoBitmap(currentID), iconW(currentID), iconH(currentID), itc );
+  }
+  else if (iconType(currentID) == ICON_565) {
+    draw565Bitmap(icox,  icoy + isy - irh + (irh * cr), colorBitmap(currentID), iconW(currentID), iconH(currentID) );
+  }
+  else if (iconType(currentID) == ICON_PACKED) {
+    drawPackedBitmap(icox,  icoy + isy - irh + (irh * cr), monoBitmap(currentID), iconW(currentID), iconH(currentID) );
+  }
+  else if (iconType(currentID) == ICON_ATLAS) {
+    drawAtlasIcon(icox,  icoy + isy - irh + (irh * cr), currentID, itc);
+  }
+
+}
+
+/*
+
+  digit edit, a selected number is edited a digit at a time, MoveUp/MoveDown roll the digit under
+  the cursor (0 - 9 round, no carry), select moves the cursor to the next digit and ends the edit
+  past the last one, so any value takes at most 5 steps a digit. while editing the value shows
+  all its digits with leading zeros (and a sign when the low limit is below 0) and the digit under
+  the cursor is underlined. touch menus show a keypad, digits are typed over the cursor, < moves
+  it back, - flips the sign and tapping the row again ends the edit. the value is kept within the
+  limits when the edit ends, not while digits are typed
+
+*/
+
+static const char keylabel[] = "789456123-0<";
+
+void EditMenu::setDigitEdit(bool Enable) {
+  dedit = Enable;
+  if (!dedit) {
+    closeKeypad();
+  }
+}
+
+void EditMenu::setKeypad(int16_t X, int16_t Y, int16_t W, int16_t H) {
+  kr.x = X;
+  kr.y = Y;
+  kr.w = W;
+  kr.h = H;
+}
+
+// whole digits an item edits, enough for the larger limit and no more than 9 digits in all
+uint8_t EditMenu::digits(int ID) {
+
+  float m = max(fabs(lowLimit(ID)), fabs(highLimit(ID)));
+  uint8_t n = 1, pl = places(ID);
+
+  while (((n + pl) < 9) && (m >= scale10[n])) {
+    n++;
+  }
+  return n;
+}
+
+// the first cursor place, the sign when there is one
+int8_t EditMenu::digitTop(int ID) {
+  return digits(ID) - ((lowLimit(ID) < 0.0) ? 0 : 1);
+}
+
+bool EditMenu::digitEdit(int ID) {
+  return dedit && rowselected && (ID > 0) && (ID == currentID) && (!hasList(ID)) && (places(ID) < 9);
+}
+
+// the size of the value of item ID in units of its last place, a typed int comes straight
+// from ival so every digit is its own
+uint32_t EditMenu::digitValue(int ID) {
+
+  uint32_t n;
+
+  if (itemKind(ID) != ITEM_INT) {
+    return scaledValue(value[ID], places(ID));
+  }
+  n = (ival[ID] < 0) ? 0 - (uint32_t) ival[ID] : (uint32_t) ival[ID];
+  return (n > 999999999) ? 999999999 : n;
+}
+
+bool EditMenu::digitNegative(int ID) {
+  return (itemKind(ID) == ITEM_INT) ? (ival[ID] < 0) : (value[ID] < 0.0);
+}
+
+// a digit edit result into item ID
+void EditMenu::setDigits(int ID, uint32_t Scaled, bool Negative) {
+
+  if (itemKind(ID) == ITEM_INT) {
+    ival[ID] = Negative ? -(int32_t) Scaled : (int32_t) Scaled;
+    value[ID] = ival[ID];
+    return;
+  }
+  value[ID] = (float) Scaled / scale10[places(ID)];
+  if (Negative) {
+    value[ID] = -value[ID];
+  }
+}
+
+// Digit 0 - 9 types that digit under the cursor, -1 rolls it by Step, on the sign it flips
+void EditMenu::editDigit(int8_t Digit, int8_t Step) {
+
+  uint8_t pl = places(currentID);
+  uint32_t s = digitValue(currentID), p;
+  bool neg = digitNegative(currentID);
+  int8_t k;
+
+  if ((dp < -pl) || (dp > digitTop(currentID))) {
+    dp = digitTop(currentID);
+  }
+
+  if (dp == digits(currentID)) {
+    neg = !neg;
+  }
+  else {
+    p = scale10[dp + pl];
+    k = (s / p) % 10;
+    s -= k * p;
+    k = (Digit >= 0) ? Digit : ((k + Step + 10) % 10);
+    s += k * p;
+  }
+  setDigits(currentID, s, neg);
+
+  lastedit = millis();
+  unsaved = true;
+  item = currentID;
+
+}
+
+// the edit is done, back within the limits and out to a bound variable
+void EditMenu::endDigits() {
+
+  if (itemKind(currentID) == ITEM_INT) {
+    ival[currentID] = constrain(ival[currentID], limit(currentID, 0).i, limit(currentID, 1).i);
+    value[currentID] = ival[currentID];
+  }
+  else {
+    value[currentID] = constrain(value[currentID], lowLimit(currentID), highLimit(currentID));
+  }
+  writeBound(currentID);
+  lastedit = millis();
+  unsaved = true;
+
+}
+
+void EditMenu::showValue() {
+
+  if (fr.period > 0) {
+    pendval = currentID;
+    fr.request();
+  }
+  else {
+    paintValue();
+  }
+
+}
+
+// underlines the digit under the cursor in Text, the value on row Y
+void EditMenu::paintDigit(const char *Text, int16_t Y) {
+
+  int8_t n = digits(currentID), k;
+  uint8_t i = 0;
+  int16_t x = valueX(Text);
+
+  dcw = 0;
+  if (!digitEdit(currentID)) {
+    return;
+  }
+  // sign, whole digits, point, places
+  k = (lowLimit(currentID) < 0.0) ? 1 : 0;
+  k += (dp >= 0) ? (n - 1 - dp) : (n - dp);
+  if (k >= (int8_t) strlen(Text)) {
+    return;
+  }
+  while (i < k) {
+    x += codeAdvance(itemf, glyphs, Text, i);
+  }
+  dcx = x;
+  dcw = codeAdvance(itemf, glyphs, Text, i);
+  fill(d, dcx, Y + irh - thick - 2, dcw, 2, istc);
+  touched(dcx, Y + irh - thick - 2, dcw, 2);
+
+}
+
+// puts the keypad up, where setKeypad said or on the larger side of the edited row, above it
+// over the rows or below it down to the bottom of the viewport or screen
+void EditMenu::openKeypad() {
+
+  int16_t bottom = view.w ? (view.y + view.h) : tft->height();
+  int8_t k;
+
+  if (kr.w > 0) {
+    kp = kr;
+  }
+  else {
+    kp.x = icox;
+    kp.w = irw - icox;
+    if ((bottom - (isy + (irh * cr))) >= (irh * (cr - 1))) {
+      kp.y = isy + (irh * cr);
+      kp.h = bottom - kp.y;
+    }
+    else {
+      kp.y = isy;
+      kp.h = irh * (cr - 1);
+    }
+  }
+  if ((kp.w < 3) || (kp.h < 4)) {
+    kp.w = 0;
+    return;
+  }
+
+  fill(d, kp.x, kp.y, kp.w, kp.h, ibc);
+  touched(kp.x, kp.y, kp.w, kp.h);
+  for (k = 0; k < 12; k++) {
+    paintKey(k, false);
+  }
+  kkey = -1;
+
+}
+
+// takes the keypad down and puts back the rows it covered
+void EditMenu::closeKeypad() {
+
+  MenuRect r = kp;
+  int id;
+  int16_t y;
+
+  if (kp.w == 0) {
+    return;
+  }
+  kp.w = 0;
+  kkey = -1;
+  if (idle) {
+    stale = true;
+    return;
+  }
+
+  fill(d, r.x, r.y, r.w, r.h, ibc);
+  touched(r.x, r.y, r.w, r.h);
+  for (id = sr + 1; (id <= totalID) && (id <= (sr + imr)); id++) {
+    y = isy - irh + (irh * (id - sr));
+    if ((y < (r.y + r.h)) && ((y + irh) > r.y)) {
+      paintRow(id);
+    }
+  }
+
+}
+
+void EditMenu::paintKey(int8_t Key, bool Pressed) {
+
+  char t[2] = {keylabel[Key], 0};
+  int16_t kw = kp.w / 3, kh = kp.h / 4;
+  int16_t x = kp.x + ((Key % 3) * kw), y = kp.y + ((Key / 3) * kh), bx, by;
+  uint16_t bw, bh, tc = Pressed ? ihtc : ttc;
+
+  if ((t[0] == '-') && (lowLimit(currentID) >= 0.0)) {
+    tc = ditc;
+  }
+  if (radius > 0) {
+    fillRound(d, x + 1, y + 1, kw - 2, kh - 2, radius, Pressed ? ihbc : tfc);
+  }
+  else {
+    fill(d, x + 1, y + 1, kw - 2, kh - 2, Pressed ? ihbc : tfc);
+  }
+  d->setFont(itemf);
+  d->setTextColor(tc);
+  d->getTextBounds(t, 0, 0, &bx, &by, &bw, &bh);
+  d->setCursor(x + ((kw - (int16_t) bw) / 2) - bx, y + ((kh - (int16_t) bh) / 2) - by);
+  d->print(t);
+  touched(x, y, kw, kh);
+
+}
+
+// a tap on Key, only the key let go of and the one pressed are repainted
+void EditMenu::pressKey(int8_t Key) {
+
+  char c = keylabel[Key];
+
+  if ((currentID < 1) || (currentID > totalID)) {
+    return;
+  }
+  if (kkey != Key) {
+    if (kkey >= 0) {
+      paintKey(kkey, false);
+    }
+    paintKey(Key, true);
+    kkey = Key;
+  }
+
+  if (c == '<') {
+    // back a digit, from the first round to the last
+    dp = (dp < digitTop(currentID)) ? (dp + 1) : -places(currentID);
+  }
+  else if (c == '-') {
+    if (lowLimit(currentID) >= 0.0) {
+      return;
+    }
+    setDigits(currentID, digitValue(currentID), !digitNegative(currentID));
+    lastedit = millis();
+    unsaved = true;
+  }
+  else {
+    // typing starts past the sign and stays on the last digit
+    if (dp == digits(currentID)) {
+      dp--;
+    }
+    editDigit(c - '0', 0);
+    if (dp > -places(currentID)) {
+      dp--;
+    }
+  }
+  showValue();
+
+}
+
+void EditMenu::setTitleColors( uint16_t TitleTextColor, uint16_t TitleFillColor) {
+  ttc = TitleTextColor;
+  tfc = TitleFillColor;
+}
+
+void EditMenu::setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight) {
+  tbt = TitleTop;
+  tbl = TitleLeft;
+  tbw = TitleWith;
+  tbh = TitleHeight;
+}
+
+void EditMenu::setTitleText( char *TitleText,  char *ExitText) {
+  strncpy(ttx, TitleText, MAX_CHAR_LEN);
+  strncpy(etx, ExitText, MAX_CHAR_LEN);
+}
+
+void EditMenu::setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin) {
+  tox = LeftMargin; // pixels to offset text in menu bar
+  toy = TopMargin;  // pixels to offset text in menu bar
+}
+
+
+void EditMenu::setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, uint16_t BorderRadius, uint16_t BorderThickness) {
+  isx = LeftMargin;  // pixels to offset text in menu bar
+  irw = Width - isx;  // pixels to offset text in menu bar
+  radius = BorderRadius;
+  thick = BorderThickness;
+  dropStrip();
+}
+
+void EditMenu::setItemColors( uint16_t DisableTextColor, uint16_t HighlightBorderColor, uint16_t SelectBorderColor) {
+  ditc = DisableTextColor;
+  bcolor = HighlightBorderColor;
+  sbcolor = SelectBorderColor;
+}
+
+void EditMenu::SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, 
+							uint16_t HighlightTextColor, uint16_t HighlightColor, uint16_t HighlightBorderColor,
+							uint16_t SelectedTextColor, uint16_t SelectedColor, uint16_t SelectBorderColor,
+							uint16_t DisableTextColor ,	uint16_t TitleTextColor, uint16_t TitleFillColor){
+
+	itc = TextColor;
+	ibc = BackgroundColor;
+	ihtc = HighlightTextColor;
+	ihbc = HighlightColor;
+	bcolor = HighlightBorderColor;
+	istc = SelectedTextColor;
+	isbc = SelectedColor;
+	sbcolor = SelectBorderColor;
+	ttc = TitleTextColor;
+	tfc = TitleFillColor;
+	ditc = DisableTextColor;
+	
+	}
+
+void EditMenu::setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin) {
+  iox = LeftMargin;  // pixels to offset text in menu bar
+  ioy = TopMargin;  // pixels to offset text in menu bar
+  mm = MenuMargin;
+  isy = tbt + tbh + mm;
+}
+
+void EditMenu::setItemText(int ID, const char *ItemText) {
+  if (defs) {
+    // tables are read only, keep the caller's string instead
+    rlabel[ID] = ItemText;
+  }
+#if MENU_ITEM_RAM
+  else {
+    strcpy(itemlabel[ID], ItemText);
+  }
+#endif
+  drawRow(ID);
+}
+
+void EditMenu::setIconMargins(uint16_t LeftMargin, uint16_t TopMargin) {
+  icox = LeftMargin; // pixels to offset text in menu bar
+  icoy = TopMargin;  // pixels to offset text in menu bar
+  dropStrip();
+}
+
+
+void EditMenu::disable(int ID) {
+  enablestate[ID] = false;
+}
+
+void EditMenu::enable(int ID) {
+  enablestate[ID] = true;
+}
+
+bool EditMenu::getEnableState(int ID) {
+  return enablestate[ID];
+}
+
+void EditMenu::setValueWidth(uint16_t Width) {
+  vcw = Width;
+  vid = 0;
+}
+
+#if MENU_BIND
+void EditMenu::bind(int ID, float *Data) {
+  if ((ID < 1) || (ID >= MAX_OPT)) return;
+  bound[ID] = Data;
+  boundtype[ID] = Data ? BIND_FLOAT : BIND_NONE;
+}
+
+void EditMenu::bind(int ID, int32_t *Data) {
+  if ((ID < 1) || (ID >= MAX_OPT)) return;
+  bound[ID] = Data;
+  boundtype[ID] = Data ? BIND_INT32 : BIND_NONE;
+}
+
+void EditMenu::bind(int ID, uint8_t *Data) {
+  if ((ID < 1) || (ID >= MAX_OPT)) return;
+  bound[ID] = Data;
+  boundtype[ID] = Data ? BIND_UINT8 : BIND_NONE;
+}
+
+// what item ID's bound variable holds as its value[] and ival, true when that differs from
+// the item, a typed item compares the int so a bound int32 past 2^24 is not lost in a float
+bool EditMenu::readBound(int ID, float &Value, int32_t &Int) {
+
+  Value = value[ID];
+  Int = ival[ID];
+  switch (boundtype[ID]) {
+    case BIND_FLOAT:
+      Value = *(float *) bound[ID];
+      // a float still at the int written to it keeps the int, as syncInt does
+      if (Value != (float) ival[ID]) {
+        Int = (int32_t) round(Value);
+      }
+      break;
+    case BIND_INT32:
+      Int = *(int32_t *) bound[ID];
+      Value = Int;
+      break;
+    case BIND_UINT8:
+      Int = *(uint8_t *) bound[ID];
+      Value = Int;
+      break;
+  }
+
+  if (itemKind(ID) == ITEM_FLOAT) {
+    return memcmp(&Value, &value[ID], sizeof(float)) != 0;
+  }
+  Int = fitInt(ID, Int);
+  Value = Int;
+  return Int != ival[ID];
+
+}
+
+// picks up changes in bound variables, value[] holds what is on screen so only values that
+// differ get repainted, and only the glyphs that differ, returns how many changed
+int EditMenu::refresh() {
+
+  char old[MAX_CHAR_LEN], buf[MAX_CHAR_LEN];
+  float v;
+  int32_t n;
+  int id, hr, count = 0;
+  uint16_t fg, bg;
+
+  for (id = 1; id <= totalID; id++) {
+
+    if (boundtype[id] == BIND_NONE) {
+      continue;
+    }
+    if ((id == currentID) && rowselected) {
+      // being edited, the edit wins and is written back
+      continue;
+    }
+    if (!readBound(id, v, n)) {
+      continue;
+    }
+    count++;
+
+    hr = id - sr;
+    if ((hr < 1) || (hr > imr) || scroll.dragging || scroll.flinging) {
+      // not on screen, or the next scroll frame shows it
+      value[id] = v;
+      ival[id] = n;
+      continue;
+    }
+    if (idle) {
+      value[id] = v;
+      ival[id] = n;
+      stale = true;
+      continue;
+    }
+    if (fr.period > 0) {
+      value[id] = v;
+      ival[id] = n;
+      pendrow[id] = true;
+      fr.request();
+      continue;
+    }
+
+    // same colors paintRow would pick
+    if ((!enabletouch) && ((cr + sr) == id)) {
+      fg = ihtc;
+      bg = ihbc;
+    }
+    else {
+      fg = enablestate[id] ? itc : ditc;
+      bg = ibc;
+    }
+
+    if (itemKind(id) == ITEM_TOGGLE) {
+      value[id] = v;
+      ival[id] = n;
+      paintToggle(id, fg, bg);
+      continue;
+    }
+    valueText(old, id);
+    value[id] = v;
+    ival[id] = n;
+    valueText(buf, id);
+    d->setFont(itemf);
+    d->setTextColor(fg);
+    paintCell(old, buf, isy - irh + (irh * hr), bg);
+  }
+
+  return count;
+
+}
+#endif
+
+void EditMenu::writeBound(int ID) {
+
+#if MENU_BIND
+  if ((ID < 1) || (ID > totalID)) return;
+
+  switch (boundtype[ID]) {
+    case BIND_FLOAT:
+      *(float *) bound[ID] = value[ID];
+      break;
+    case BIND_INT32:
+      *(int32_t *) bound[ID] = (itemKind(ID) == ITEM_FLOAT) ? (int32_t) round(value[ID]) : ival[ID];
+      break;
+    case BIND_UINT8:
+      *(uint8_t *) bound[ID] = (uint8_t) constrain(round(value[ID]), 0, 255);
+      break;
+  }
+#else
+  (void) ID;
+#endif
+
+}
+
+void EditMenu::SetItemValue(int ID, float ItemValue) {
+  value[ID] = ItemValue;
+  syncInt(ID);
+  writeBound(ID);
+  if ((fr.period > 0) && (ID > 0) && (ID <= totalID)) {
+    pendrow[ID] = true;
+    fr.request();
+  }
+}
+
+// value of a toggle (0 or 1), enum (the list index) or int item, a float item rounded
+int32_t EditMenu::getInt(int ID) {
+  if ((ID < 1) || (ID > totalID)) return 0;
+  if (itemKind(ID) == ITEM_FLOAT) return (int32_t) round(value[ID]);
+  return ival[ID];
+}
+
+// SetItemValue without the float, a toggle takes 0 or 1 and an enum is kept in its list
+void EditMenu::setInt(int ID, int32_t ItemValue) {
+  if ((ID < 1) || (ID > totalID)) return;
+  if (itemKind(ID) != ITEM_FLOAT) {
+    ItemValue = fitInt(ID, ItemValue);
+    ival[ID] = ItemValue;
+  }
+  value[ID] = ItemValue;
+  writeBound(ID);
+  if (fr.period > 0) {
+    pendrow[ID] = true;
+    fr.request();
+  }
+}
+
+/*
+
+  values are kept as a journal of 8 byte records, epoch (2), item ID (1), value (4), crc (1)
+  the value is the float of a float item, a toggle, enum or int item keeps its int32 there and
+  has JOURNAL_INT set in the ID byte so an int past 2^24 comes back whole
+  the space is split into two regions, edits are appended to one region and when it fills
+  every value is written to the start of the other region followed by a marker record (ID 0)
+  and the epoch goes up, restore() uses the newest region that has its marker so a power loss
+  while switching regions leaves the old one good. each record slot is written once per lap
+  the marker's value is the JOURNAL_VERSION the region was written with, version 1 wrote 0 and
+  only floats, a region of an older version is read as it was written and then copied out whole
+
+*/
+
+void EditMenu::setStore(MenuStore *Store, uint32_t Address, uint32_t Size, uint16_t IdleSave) {
+  store = Store;
+  jbase = Address;
+  jslots = (Size / 2) / JOURNAL_RECORD;
+  idlesave = IdleSave;
+  jfound = false;
+  jvalid = false;
+}
+
+bool EditMenu::readRecord(uint8_t Region, uint16_t Slot, uint16_t &Epoch, uint8_t &ID, uint32_t &Value) {
+
+  uint8_t rec[JOURNAL_RECORD];
+
+  store->read(jbase + (((uint32_t) Region * jslots) + Slot) * JOURNAL_RECORD, rec, JOURNAL_RECORD);
+  if (crc8(rec, JOURNAL_RECORD - 1) != rec[JOURNAL_RECORD - 1]) {
+    return false;
+  }
+  Epoch = rec[0] | (rec[1] << 8);
+  ID = rec[2];
+  memcpy(&Value, &rec[3], sizeof(Value));
+  return true;
+
+}
+
+void EditMenu::writeRecord(uint8_t ID, uint32_t Value) {
+
+  uint8_t rec[JOURNAL_RECORD];
+
+  rec[0] = jepoch & 0xFF;
+  rec[1] = jepoch >> 8;
+  rec[2] = ID;
+  memcpy(&rec[3], &Value, sizeof(Value));
+  rec[JOURNAL_RECORD - 1] = crc8(rec, JOURNAL_RECORD - 1);
+  store->write(jbase + (((uint32_t) jregion * jslots) + jslot) * JOURNAL_RECORD, rec, JOURNAL_RECORD);
+  jslot++;
+
+}
+
+// the 32 bits item ID is journaled as, the float of a float item or the int of a typed one
+uint32_t EditMenu::itemBits(int ID) {
+
+  uint32_t bits;
+
+  if (itemKind(ID) != ITEM_FLOAT) {
+    return (uint32_t) ival[ID];
+  }
+  memcpy(&bits, &value[ID], sizeof(bits));
+  return bits;
+
+}
+
+void EditMenu::writeItem(int ID) {
+  saved[ID] = itemBits(ID);
+  writeRecord(ID | ((itemKind(ID) != ITEM_FLOAT) ? JOURNAL_INT : 0), saved[ID]);
+}
+
+// finds the newest region that has its marker, jregion and jepoch are set to it
+bool EditMenu::findJournal() {
+
+  uint16_t epoch[2], e, slot;
+  bool good[2] = {false, false};
+  uint8_t r, id, ver[2] = {1, 1};
+  uint32_t v;
+
+  // a region is good when its first records carry the marker
+  for (r = 0; r < 2; r++) {
+    if (!readRecord(r, 0, epoch[r], id, v)) {
+      continue;
+    }
+    for (slot = 0; slot < jslots; slot++) {
+      if ((!readRecord(r, slot, e, id, v)) || (e != epoch[r])) {
+        break;
+      }
+      if (id == 0) {
+        good[r] = true;
+        ver[r] = (v == 0) ? 1 : v;
+        break;
+      }
+    }
+  }
+
+  jfound = good[0] || good[1];
+  if (!jfound) {
+    return false;
+  }
+
+  if (good[0] && good[1]) {
+    jregion = ((int16_t) (epoch[1] - epoch[0]) > 0) ? 1 : 0;
+  }
+  else {
+    jregion = good[1] ? 1 : 0;
+  }
+  jepoch = epoch[jregion];
+  jver = ver[jregion];
+  return true;
+
+}
+
+int EditMenu::restore() {
+
+  uint16_t e;
+  bool found[MAX_OPT];
+  uint8_t id, tag;
+  uint32_t v;
+  float f;
+  int count = 0;
+
+  if ((!store) || (jslots == 0)) {
+    return -1;
+  }
+
+  jvalid = false;
+  if (!findJournal()) {
+    return 0;
+  }
+
+  // play the region back, later records win
+  memset(found, 0, sizeof(found));
+  for (jslot = 0; jslot < jslots; jslot++) {
+    if ((!readRecord(jregion, jslot, e, tag, v)) || (e != jepoch)) {
+      break;
+    }
+    id = (jver > 1) ? (tag & ~JOURNAL_INT) : tag;
+    if ((id == 0) || (id > totalID)) {
+      continue;
+    }
+    if ((jver > 1) && (tag & JOURNAL_INT)) {
+      // straight into ival, the float would round it
+      if (itemKind(id) != ITEM_FLOAT) {
+        ival[id] = fitInt(id, (int32_t) v);
+        value[id] = ival[id];
+      }
+      else {
+        value[id] = (int32_t) v;
+      }
+    }
+    else {
+      memcpy(&f, &v, sizeof(f));
+      value[id] = f;
+      syncInt(id);
+    }
+    found[id] = true;
+  }
+
+  for (id = 1; id <= totalID; id++) {
+    saved[id] = itemBits(id);
+    if (found[id]) {
+      writeBound(id);
+      count++;
+    }
+  }
+
+  // items the journal didn't have, or a journal of an older version, get written out with the
+  // next full copy, still into the other region with the next epoch so a power loss during it
+  // leaves this one newest
+  jvalid = (count == totalID) && (jver == JOURNAL_VERSION);
+  unsaved = false;
+  return count;
+
+}
+
+int EditMenu::save() {
+
+  int id, count = 0;
+
+  if ((!store) || (jslots <= totalID) || (totalID >= JOURNAL_INT)) {
+    return -1;
+  }
+
+  // saving without a restore() first still has to go past what is in the store
+  if (!jfound) {
+    findJournal();
+  }
+
+  if (jvalid) {
+    for (id = 1; id <= totalID; id++) {
+      if (itemBits(id) != saved[id]) {
+        count++;
+      }
+    }
+  }
+
+  if ((jvalid) && ((jslot + count) <= jslots)) {
+    // room to add just what changed
+    for (id = 1; id <= totalID; id++) {
+      if (itemBits(id) != saved[id]) {
+        writeItem(id);
+      }
+    }
+  }
+  else {
+    // full copy of every value into the other region
+    jregion = jfound ? jregion ^ 1 : 0;
+    jepoch = jfound ? jepoch + 1 : 1;
+    jslot = 0;
+    for (id = 1; id <= totalID; id++) {
+      writeItem(id);
+    }
+    writeRecord(0, JOURNAL_VERSION);
+    count = totalID;
+    jver = JOURNAL_VERSION;
+    jfound = true;
+    jvalid = true;
+  }
+
+  if (count > 0) {
+    store->commit();
+  }
+  unsaved = false;
+  return count;
+
+}
+
+void EditMenu::drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color) {
+
+  MENU_PROBE(PROF_MONO);
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_MONO, bitmap, w, 0, 0, w, h, color);
+    return;
+  }
+
+  uint8_t sbyte = 0;
+  uint8_t byteWidth = 0;
+  int jj, ii;
+
+  byteWidth = (w + 7) / 8;
+
+  for (jj = 0; jj < h; jj++) {
+    for (ii = 0; ii < w; ii++) {
+      if (ii & 7)  sbyte <<= 1;
+      else sbyte   = pgm_read_byte(bitmap + jj * byteWidth + ii / 8);
+      if (sbyte & 0x80) {
+        d->drawPixel(x + ii, y + jj, color);
+        MENU_PIXELS(1);
+      }
+    }
+  }
+
+}
+
+void EditMenu::draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h) {
+
+  MENU_PROBE(PROF_565);
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_565, bitmap, w, 0, 0, w, h, 0);
+    return;
+  }
+
+  uint32_t offset = 0;
+
+  int j, i;
+
+  for (i = 0; i < h; i++) {
+    for (j = 0; j < w; j++) {
+      d->drawPixel(j + x, i + y, pgm_read_word_near(bitmap + offset));
+      offset++;
+    }
+  }
+  MENU_PIXELS((uint32_t) w * h);
+
+}
+
+// draws a packed icon, on screen a run goes out as one fill and runs wrap rows inside the
+// address window by themselves, a clipped icon falls back to pixels
+void EditMenu::drawPackedBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h) {
+
+  MENU_PROBE(PROF_PACKED);
+
+  MenuUnpack pk = {};
+  MenuBurst b = {};
+  uint32_t total = (uint32_t) w * h, k;
+  int j, i;
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_PACKED, bitmap, w, 0, 0, w, h, 0);
+    return;
+  }
+
+  pk.begin(bitmap);
+
+  if ((x >= 0) && (y >= 0) && ((x + w) <= d->width()) && ((y + h) <= d->height())) {
+    b.begin(tft, cv, x, y, w, h);
+    for (k = total; k > 0; k -= pk.left) {
+      pk.run();
+      if (pk.left > k) {
+        pk.left = k;
+      }
+      b.color(pk.color, pk.left);
+    }
+    b.end();
+  }
+  else {
+    for (i = 0; i < h; i++) {
+      for (j = 0; j < w; j++) {
+        d->drawPixel(j + x, i + y, pk.next());
+      }
+    }
+  }
+  MENU_PIXELS(total);
+
+}
+
+/*
+
+  object type to create a simple selection only menu unlike previous where selecting a line item would allow in-line editing
+
+
+*/
+
+
+
+ItemMenu::ItemMenu(Adafruit_ST7735 *Display, bool EnableTouch) {
+  d = Display;
+  tft = Display;
+  enabletouch = EnableTouch;
+}
+
+ItemMenu::~ItemMenu() {
+  delete strip;
+}
+
+// the scroll strip is as wide and as high as a row, anything that moves the row edges or the
+// row height drops it and the next drag makes a new one
+void ItemMenu::dropStrip() {
+  delete strip;
+  strip = nullptr;
+}
+
+void ItemMenu::init(uint16_t TextColor, uint16_t BackgroundColor,
+                    uint16_t HighlightTextColor, uint16_t HighlightColor,
+                    uint16_t ItemRowHeight, uint16_t MaxRow,
+                    const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont) {
+
+  itc = TextColor;
+  ibc = BackgroundColor;
+  ihtc = HighlightTextColor;
+  ihbc = HighlightColor;
+  bcolor = TextColor;
+  tbt = 0;      // title bar top
+  tbl = 0;      // title bar left
+  tbh = 40;     // title bar height
+  tbw = d->width(); // title bar width, default to screen width
+  tox = 20;     // x pixel offset for title text to offset from left a bit
+  toy  = 10;        // y pixel offset for title text to manage height offset from top
+  isx = 0;      // where to start the menu item from left, default indent 10
+  icox = 0;
+  icoy = 0;
+  mm = 5;
+  isy = tbt + tbh + mm; // where to start the menu item from top, note because array is 1 based we start drawing down a row--so back off a row, but pad 10
+  irh = ItemRowHeight;  // select bar height
+  irw = tbw - isx;    // select bar width, default to full width
+  imr = MaxRow;     // user has to indicate this
+  fimr = MaxRow;    // and imr is this or less when the list is short
+  iox = 0;        // pixels to offset text in menu bar
+  ioy = 0;        // pixels to offset text in menu bar
+  itemf = &ItemFont;     // item font
+  titlef = &TitleFont;   // menu bar font, default to item font
+  ttc = TextColor;    // title text color
+  tfc = HighlightColor; // title fill color
+  ditc = MENU_C_DKGREY;
+  strncpy(ttx, TitleText, MAX_CHAR_LEN);
+  strncpy(etx, EXIT_TEXT, 6);
+  item = 1;
+  drawTitleFlag = true; // flag if we draw menu bar again
+  currentID = 1;    // id of current highlighted or selected item (1 to ID)
+  cr = 1;       // current selected row on the screen (1 to mr-1)
+  totalID = 0;      // maximum number of items (where first position is 1)
+  vn = 0;
+#if MENU_FILTER
+  filt = false;
+#endif
+  sr = 0;       // draw offset for the menu array where first postion is 0
+  pr = 1;       // previous selected rown (1 to mr - 1)
+  rowselected = false;
+  enablestate[0] = true;
+  redraw = true;
+  radius = 0;
+  thick = 0;
+  // a menu on the stack or the heap starts out with junk in these
+  memset(pendrow, 0, sizeof(pendrow));
+  memset(aicon, 0, sizeof(aicon));
+  dropStrip();
+
+}
+
+
+void ItemMenu::setInitialItem(int ItemID){
+	
+	// not taking into account if the first item is disabled, or filtered out
+	ItemID = place(ItemID);
+	if ((ItemID > vn) || (ItemID < 0)) {
+		ItemID = 0;
+	}
+
+	currentID = ItemID;  
+	// items past the first screen go on the last row
+	sr = (ItemID > (int) imr) ? ItemID - imr : 0;
+	cr = ItemID - sr; 
+	pr = cr;
+}
+
+
+#if MENU_ITEM_RAM
+int ItemMenu::addNI(const char *ItemLabel) {
+
+  totalID++;
+
+  IconType[totalID] = ICON_NONE;
+
+  enablestate[totalID] = true;
+  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
+  listNew();
+  return (totalID);
+
+}
+
+int ItemMenu::addMono(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+
+  itemBitmap[totalID] = Bitmap;
+  
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_MONO;
+
+  enablestate[totalID] = true;
+  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
+  listNew();
+  return (totalID);
+}
+
+int ItemMenu::add565(const char *ItemLabel, const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+
+  item565Bitmap[totalID] = Bitmap;
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_565;
+
+  enablestate[totalID] = true;
+  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
+    
+  listNew();
+  return (totalID);
+}
+
+int ItemMenu::addPacked(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+
+  totalID++;
+
+  itemBitmap[totalID] = Bitmap;
+  bmp_w[totalID] = BitmapWidth;
+  bmp_h[totalID] = BitmapHeight;
+  IconType[totalID] = ICON_PACKED;
+
+  enablestate[totalID] = true;
+  strncpy(itemlabel[totalID], ItemLabel, MAX_CHAR_LEN);
+
+  listNew();
+  return (totalID);
+}
+#endif
+
+int ItemMenu::addItems(const MenuItemDef *Items, uint8_t Count) {
+
+  defs = Items;
+  totalID = 0;
+
+  for (uint8_t i = 0; (i < Count) && (totalID < MAX_OPT - 1); i++) {
+    totalID++;
+    rlabel[totalID] = nullptr;
+    enablestate[totalID] = true;
+  }
+#if MENU_FILTER
+  filt = false;
+#endif
+  vn = totalID;
+
+  return (totalID);
+
+}
+
+uint8_t ItemMenu::iconType(int ID) {
+  uint8_t t;
+  if ((ID < 1) || (ID > vn)) return ICON_NONE;
+  ID = at(ID);
+  if (atlasOf(ID)) return ICON_ATLAS;
+#if MENU_ITEM_RAM
+  if (!defs) return IconType[ID];
+#endif
+  t = pgm_read_byte(&defs[ID - 1].icon);
+  // an atlas item with no atlas set has no icon
+  return (t == ICON_ATLAS) ? ICON_NONE : t;
+}
+
+const unsigned char *ItemMenu::monoBitmap(int ID) {
+  if ((ID < 1) || (ID > vn)) return nullptr;
+  ID = at(ID);
+#if MENU_ITEM_RAM
+  if (!defs) return itemBitmap[ID];
+#endif
+  return (const unsigned char *) pgm_read_ptr(&defs[ID - 1].mono);
+}
+
+const uint16_t *ItemMenu::colorBitmap(int ID) {
+  if ((ID < 1) || (ID > vn)) return nullptr;
+  ID = at(ID);
+#if MENU_ITEM_RAM
+  if (!defs) return item565Bitmap[ID];
+#endif
+  return (const uint16_t *) pgm_read_ptr(&defs[ID - 1].color);
+}
+
+uint8_t ItemMenu::iconW(int ID) {
+  uint8_t k;
+  if ((ID < 1) || (ID > vn)) return 0;
+  ID = at(ID);
+  k = atlasOf(ID);
+  if (k) return pgm_read_byte(&((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1].w);
+#if MENU_ITEM_RAM
+  if (!defs) return bmp_w[ID];
+#endif
+  if (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS) return 0;
+  return pgm_read_byte(&defs[ID - 1].w);
+}
+
+uint8_t ItemMenu::iconH(int ID) {
+  uint8_t k;
+  if ((ID < 1) || (ID > vn)) return 0;
+  ID = at(ID);
+  k = atlasOf(ID);
+  if (k) return pgm_read_byte(&((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1].h);
+#if MENU_ITEM_RAM
+  if (!defs) return bmp_h[ID];
+#endif
+  if (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS) return 0;
+  return pgm_read_byte(&defs[ID - 1].h);
+}
+
+// atlas icon of the item in list place ID
+uint8_t ItemMenu::atlasIcon(int ID) {
+  if ((ID < 1) || (ID > vn)) return 0;
+  return atlasOf(at(ID));
+}
+
+// atlas icon of item ID, setItemIcon wins over a MenuIcon table entry, 0 if none
+uint8_t ItemMenu::atlasOf(int ID) {
+  uint8_t k;
+  if ((!atlas) || (ID < 1) || (ID > totalID)) return 0;
+  k = aicon[ID];
+  if ((!k) && defs && (pgm_read_byte(&defs[ID - 1].icon) == ICON_ATLAS)) {
+    k = pgm_read_byte(&defs[ID - 1].w);
+  }
+  return (k <= pgm_read_byte(&atlas->count)) ? k : 0;
+}
+
+// where the icon pixels of an item are, the atlas sheet and the rectangle in it or the item's
+// own bitmap as a sheet of its own width, returns the bitmap type
+uint8_t ItemMenu::iconSheet(int ID, const void *&Bits, uint16_t &Width, uint16_t &X, uint16_t &Y) {
+
+  uint8_t k = atlasIcon(ID), t;
+  const MenuIconRect *r;
+
+  if (k) {
+    r = &((const MenuIconRect *) pgm_read_ptr(&atlas->rect))[k - 1];
+    Bits = pgm_read_ptr(&atlas->sheet);
+    Width = pgm_read_word(&atlas->width);
+    X = pgm_read_word(&r->x);
+    Y = pgm_read_word(&r->y);
+    return pgm_read_byte(&atlas->type);
+  }
+  t = iconType(ID);
+  Bits = (t == ICON_565) ? (const void *) colorBitmap(ID) : (const void *) monoBitmap(ID);
+  Width = iconW(ID);
+  X = 0;
+  Y = 0;
+  return t;
+}
+
+void ItemMenu::drawAtlasIcon(int16_t x, int16_t y, int ID, uint16_t color) {
+
+  const void *bits;
+  uint16_t sw, sx, sy;
+  uint8_t t = iconSheet(ID, bits, sw, sx, sy);
+
+  if (d == ls) {
+    ls->icon(x, y, t, bits, sw, sx, sy, iconW(ID), iconH(ID), color);
+    return;
+  }
+  blitIcon(tft, cv, x, y, t, bits, sw, sx, sy, iconW(ID), iconH(ID), color);
+
+}
+
+// Right is where a label is cut inside a viewport, 0 for the end of the row
+void ItemMenu::printLabel(Adafruit_GFX *Out, int ID, int16_t Right) {
+
+  char buf[MAX_CHAR_LEN];
+  const char *src;
+  uint8_t k = 0;
+
+  if ((ID < 1) || (ID > vn)) return;
+  ID = at(ID);
+
+  if (defs) {
+    if (rlabel[ID]) {
+      src = rlabel[ID];
+    }
+    else if ((!glyphs) && (view.w == 0)) {
+      Out->print((const __FlashStringHelper *) pgm_read_ptr(&defs[ID - 1].label));
+      return;
+    }
+    else {
+      // the atlas lookups and clipping want the label in RAM
+      src = (const char *) pgm_read_ptr(&defs[ID - 1].label);
+      while ((k < MAX_CHAR_LEN - 1) && (buf[k] = pgm_read_byte(src + k))) {
+        k++;
+      }
+      buf[k] = 0;
+      src = buf;
+    }
+  }
+  else {
+#if MENU_ITEM_RAM
+    src = itemlabel[ID];
+#else
+    return;
+#endif
+  }
+  if (view.w > 0) {
+    // the strips start at x0, so their right edge is their width
+    if (Right == 0) {
+      Right = (Out == d) ? irw : Out->width();
+    }
+    printText(Out, itemf, glyphs, src, textFit(itemf, glyphs, src, Right - Out->getCursorX()));
+    return;
+  }
+  printText(Out, itemf, glyphs, src, strlen(src));
+
+}
+
+void ItemMenu::drawHeader(bool hl, uint8_t style) {
+
+  MENU_PROBE(PROF_HEADER);
+
+  touched(tbl, tbt, tbw, tbh);
+
+  d->setFont(titlef);
+
+  if (enabletouch) {
+
+    if (style == BUTTON_PRESSED) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ttc);
+      printTitle(titleText());
+    }
+    else {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      printTitle(titleText());
+    }
+
+    if (vn > ((gc > 0) ? gc * gr : imr)) {
+      headerArrows(d, tbl, tbt, tbw, tbh, huw, hdw, ttc);
+    }
+
+  }
+  else {
+    if (hl) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ihtc);
+      printTitle(etx);
+
+      d->fillTriangle( tbl + tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) - 3,
+                       tbl + tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) - (tbh / 3.0),
+                       tbl + tbw - 5,       tbt + (tbh / 2.0) - 3,
+                       ihtc);
+
+      d->fillTriangle( tbl + tbw - (tbh / 3.0) - 5, tbt + (tbh / 2.0) + 3,
+                       tbl + tbw - (tbh / 6.0) - 5, tbt + (tbh / 2.0) + (tbh / 3.0),
+                       tbl + tbw - 5,       tbt + (tbh / 2.0) + 3,
+                       ihtc);
+    }
+
+    else {
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      printTitle(titleText());
+    }
+  }
+
+}
+
+
+
+int ItemMenu::press(int16_t ScreenX, int16_t ScreenY) {
+
+  if (wake()) {
+    return -1;
+  }
+
+  MENU_PROBE(PROF_PRESS);
+
+  MenuHit hit;
+
+  if (!hitTest(ScreenX, ScreenY, hit)) {
+    return -1;
+  }
+
+  if (hit.zone == ZONE_UPARROW) {
+    // up arrow
+    if (gc > 0) {
+      gridPage(-1);
+      return -1;
+    }
+    if (cr == 1) {
+      cr = imr;
+    }
+    MoveDown();
+    return -1;
+  }
+
+  if (hit.zone == ZONE_DOWNARROW) {
+    // down arrow
+    if (gc > 0) {
+      gridPage(1);
+      return -1;
+    }
+    if (cr <= imr) {
+      cr = 0;
+    }
+    MoveUp();
+    return -1;
+  }
+
+  if (hit.zone == ZONE_HEADER) {
+    return 0;
+  }
+
+  // icons sit left of the menu bar and are not part of the row, in a grid they are the cell
+  if (((hit.zone == ZONE_ICON) && (gc == 0)) || (!enablestate[hit.id])) {
+    return -1;
+  }
+
+  return hit.id;
+}
+
+bool ItemMenu::hitTest(int16_t ScreenX, int16_t ScreenY, MenuHit &Hit) {
+
+  int bs, off, hr, cw, gx, gy;
+
+  Hit.row = -1;
+  Hit.id = -1;
+  Hit.zone = ZONE_NONE;
+
+  // check if header pressed
+  if (  (ScreenX > tbl) && (ScreenX < (tbw + tbl))  &&  (ScreenY > tbt ) && (ScreenY < (tbt + tbh) )) {
+    Hit.row = 0;
+    Hit.id = 0;
+    if (ScreenX < (tbl + huw)) {
+      Hit.zone = ZONE_UPARROW;
+    }
+    else if (ScreenX > (tbl + tbw - hdw)) {
+      Hit.zone = ZONE_DOWNARROW;
+    }
+    else {
+      Hit.zone = ZONE_HEADER;
+    }
+    return true;
+  }
+
+  if (gc > 0) {
+    // cells are all the same size so the cell comes straight from the offsets
+    cw = (irw - view.x - isx) / gc;
+    if ((ScreenX < (view.x + isx)) || (ScreenY < isy)) {
+      return false;
+    }
+    gx = (ScreenX - view.x - isx) / cw;
+    gy = (ScreenY - isy) / gch;
+    if ((gx >= gc) || (gy >= gr) || ((sr + (gy * gc) + gx + 1) > vn)) {
+      return false;
+    }
+    Hit.row = (gy * gc) + gx + 1;
+    Hit.id = sr + Hit.row;
+    bs = view.x + isx + (gx * cw) + ((cw - iconW(Hit.id)) / 2);
+    off = isy + (gy * gch) + icoy;
+    if ((iconType(Hit.id) != ICON_NONE) && (ScreenX >= bs) && (ScreenX < (bs + iconW(Hit.id))) &&
+        (ScreenY >= off) && (ScreenY < (off + iconH(Hit.id)))) {
+      Hit.zone = ZONE_ICON;
+    }
+    else {
+      Hit.zone = ZONE_LABEL;
+    }
+    Hit.id = at(Hit.id);
+    return true;
+  }
+
+  // rows are all irh high so the row comes straight from the y offset
+  off = ScreenY - isy;
+  if ((off <= -slop) || (off >= (irh * imr) + slop)) {
+    return false;
+  }
+  if (slop == 0) {
+    // no slop, the line between two rows belongs to neither
+    if ((off % irh) == 0) {
+      return false;
+    }
+  }
+  else {
+    off = constrain(off, 0, (irh * imr) - 1);
+  }
+
+  hr = (off / irh) + 1;
+  if ((hr + sr) > vn) {
+    return false;
+  }
+
+  bs = icox + iconW(hr + sr) + isx;
+
+  if ((iconType(hr + sr) != ICON_NONE) && (ScreenX >= icox) && (ScreenX < (icox + iconW(hr + sr)))) {
+    Hit.zone = ZONE_ICON;
+  }
+  else if ((ScreenX > (bs - slop)) && (ScreenX < (irw + slop))) {
+    Hit.zone = ZONE_LABEL;
+  }
+  else {
+    return false;
+  }
+
+  Hit.row = hr;
+  Hit.id = at(hr + sr);
+  return true;
+
+}
+
+void ItemMenu::setTouchSlop(uint8_t Slop) {
+  slop = Slop;
+}
+
+void ItemMenu::setHeaderZones(uint16_t UpArrowWidth, uint16_t DownArrowWidth) {
+  huw = UpArrowWidth;
+  hdw = DownArrowWidth;
+}
+
+void ItemMenu::setScrollPhysics(uint8_t DragThreshold, uint16_t Deceleration) {
+  scroll.threshold = DragThreshold;
+  scroll.decel = Deceleration;
+}
+
+int ItemMenu::touch(int16_t ScreenX, int16_t ScreenY, uint8_t Event) {
+
+  if (wake() || waking) {
+    // the touch that woke the menu goes no further, up to its release
+    waking = (Event != TOUCH_UP);
+    return -1;
+  }
+
+  if (gc > 0) {
+    // grids page instead of scrolling, a touch is a tap where it went down
+    if (Event == TOUCH_DOWN) {
+      tx = ScreenX;
+      ty = ScreenY;
+    }
+    else if (Event == TOUCH_UP) {
+      return press(tx, ty);
+    }
+    return -1;
+  }
+
+  if (Event == TOUCH_DOWN) {
+    tx = ScreenX;
+    ty = ScreenY;
+    // a touch during a flick just stops it
+    caught = scroll.flinging;
+    if (caught) {
+      settleScroll();
+    }
+    if ((vn <= imr) || (ScreenY < isy)) {
+      scroll.press(ScreenY, sr * irh, sr * irh, sr * irh);
+    }
+    else {
+      scroll.press(ScreenY, sr * irh, (vn - imr) * irh);
+    }
+    return -1;
+  }
+
+  if (Event == TOUCH_MOVE) {
+    if (scroll.move(ScreenY)) {
+      if (fr.period > 0) {
+        pendscroll = true;
+        fr.request();
+      }
+      else {
+        drawScroll();
+      }
+    }
+    return -1;
+  }
+
+  if (scroll.release()) {
+    if (!scroll.flinging) {
+      settleScroll();
+    }
+    return -1;
+  }
+
+  if (caught) {
+    return -1;
+  }
+
+  // not a drag so it's a tap
+  return press(tx, ty);
+
+}
+
+bool ItemMenu::updateScroll() {
+
+  if ((!scroll.flinging) || idle) {
+    return false;
+  }
+  if (scroll.step()) {
+    if (fr.period > 0) {
+      pendscroll = true;
+      fr.request();
+    }
+    else {
+      drawScroll();
+    }
+  }
+  if (!scroll.flinging) {
+    settleScroll();
+  }
+  return true;
+
+}
+
+void ItemMenu::drawScroll() {
+
+  const void *bits;
+  uint16_t sw, sx, sy;
+  byte type;
+  MENU_PROBE(PROF_SCROLL);
+
+  int16_t x0 = view.w ? icox : min(icox, isx);  // leftmost pixel a row draws to
+  int16_t y, y0, y1;
+  int k, id, first, po, bs;
+  uint16_t tc;
+
+  if (!strip) {
+    strip = new GFXcanvas1(irw - x0, irh);
+  }
+  if ((!strip) || (!strip->getBuffer())) {
+    return;
+  }
+
+  first = scroll.pos / irh;
+  po = scroll.pos % irh;
+
+  strip->setFont(itemf);
+  strip->setTextWrap(false);
+
+  // one more row than fits since the top and bottom rows can be part way off
+  for (k = 0; k <= imr; k++) {
+
+    id = first + k + 1;
+    y = isy + (k * irh) - po;
+    y0 = max(y, (int16_t) isy);
+    y1 = min((int16_t) (y + irh), (int16_t) (isy + (imr * irh)));
+    if (y1 <= y0) {
+      continue;
+    }
+
+    strip->fillScreen(0);
+    touched(x0, y0, irw - x0, y1 - y0);
+
+    if (id > vn) {
+      blitStrip(tft, cv, strip, x0, y, y0 - y, y1 - y0, ibc, ibc, ICON_NONE, nullptr, 0, 0, 0, 0, 0, 0, 0, 0);
+      continue;
+    }
+
+    bs = icox + iconW(id) + isx;
+    tc = enablestate[at(id)] ? itc : ditc;
+
+    strip->setCursor(bs + iox - x0, ioy);
+    printLabel(strip, id);
+
+    type = iconSheet(id, bits, sw, sx, sy);
+    blitStrip(tft, cv, strip, x0, y, y0 - y, y1 - y0, tc, ibc, type, bits, sw, sx, sy,
+              icox - x0, icoy, iconW(id), iconH(id), itc);
+  }
+
+  sr = first;
+
+}
+
+void ItemMenu::settleScroll() {
+
+  // snap to the nearest whole row
+  sr = (scroll.pos + (irh / 2)) / irh;
+  scroll.pos = sr * irh;
+  scroll.flinging = false;
+  pendscroll = false;
+  drawScroll();
+
+  if ((currentID > 0) && ((currentID <= sr) || (currentID > (sr + imr)))) {
+    currentID = sr + 1;
+  }
+  if (currentID > 0) {
+    cr = currentID - sr;
+  }
+  pr = cr;
+
+}
+
+void ItemMenu::drawRow(int ID, uint8_t style) {
+
+  // the sketch gives items, rows are list places
+  ID = place(ID);
+  if (ID < 0) {
+    return;
+  }
+
+  if (idle) {
+    stale = true;
+    return;
+  }
+
+  if (fr.period == 0) {
+    paintRow(ID, style);
+    return;
+  }
+  if ((ID >= 0) && (ID <= vn)) {
+    pendrow[ID] = style + 1;
+    fr.request();
+  }
+
+}
+
+void ItemMenu::paintRow(int ID, uint8_t style) {
+
+  if (gc > 0) {
+    paintTile(ID, style);
+    return;
+  }
+
+  MENU_PROBE(PROF_ROW);
+
+  int  bs;
+  int hr = ID - sr;
+
+  if (ID == 0) {
+    drawHeader(false, style);
+  }
+
+  if (ID <= 0) {
+    return;
+  }
+
+  if (!enabletouch) {
+    // a key driven list has no buttons, the row is drawn again as the list draws it
+    if ((hr >= 1) && (hr <= (int) imr)) {
+      d->setFont(itemf);
+      moreup = (hr == cr) && (cr == 1);
+      moredown = (hr == cr) && (cr == (int) imr);
+      redraw = true;
+      paintLine(hr);
+      redraw = false;
+      moreup = false;
+      moredown = false;
+    }
+    return;
+  }
+
+  bs = icox + iconW(ID) + isx;
+
+  if (!enablestate[at(ID)]) {
+    return;
+  }
+
+  if (ID == 0) {
+    if (style == BUTTON_PRESSED) {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, ihbc);
+      d->setTextColor(ttc);
+      d->print(ttx);
+    }
+    else {
+      // draw new menu bar
+      d->setCursor(tbl + tox, tbt + toy);
+      fill(d, tbl, tbt, tbw, tbh, tfc);
+      d->setTextColor(ttc);
+      d->print(ttx);
+    }
+  }
+  else {
+
+    touched(bs, isy - irh + (irh * hr), irw - bs, irh);
+
+    if (style == BUTTON_PRESSED) {
+
+      if (radius > 0) {
+        fillRound(d, bs,      isy - irh + (irh * hr) ,     irw - bs,       irh,        radius,   bcolor);
+        fillRound(d, bs + thick,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
+      }
+      else {
+        fill(d, bs,       isy - irh + (irh * hr) ,     irw - bs  ,        irh, bcolor);
+        fill(d, bs + thick ,  isy - irh + (irh * hr) + thick,  irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
+      }
+
+    }
+    else {
+
+      fill(d, bs, isy - irh + (irh * hr) , irw - bs, irh, ibc); // back color
+
+    }
+
+    // write text
+    itx = bs + iox;
+    d->setFont(itemf);
+    d->setTextColor(ihtc);
+    d->setCursor(itx , isy - irh + (irh * hr) + ioy);
+    printLabel(d, ID);
+
+  }
+
+}
+
+
+void ItemMenu::draw() {
+
+  if (idle) {
+    stale = true;
+    return;
+  }
+  lastinput = millis();
+
+  // a full draw lands a flick on a whole row first
+  if (scroll.flinging) {
+    settleScroll();
+  }
+
+  if (ls) {
+    d = ls;
+    ls->begin();
+  }
+  drawHeader(false, 0);
+  drawItems();
+  if (ls) {
+    ls->end();
+    d = cv ? (Adafruit_GFX *) cv : tft;
+  }
+  // everything is on screen now
+  clearPending();
+}
+
+void ItemMenu::drawItems() {
+
+  if (gc > 0) {
+    paintTiles();
+    return;
+  }
+
+  scrollItems();
+
+  if (enablestate[at(currentID)] == false) {
+    return;
+  }
+
+  paintItems();
+
+}
+
+void ItemMenu::scrollItems() {
+
+  if (imr > vn) {
+    imr = vn;
+  }
+  redraw = false;
+  // determine if we need to pan or just increment the list
+
+  if ((currentID >  vn) && (sr >= 0) ) {
+    // up to top
+    cr = 0;
+    currentID = 0;
+    sr = 0;
+    redraw = true;
+  }
+  else if ((cr < 0) || (currentID < 0)) {
+    //  pan whole menu to bottom, up from the header lands here even if the list was scrolled
+    cr = imr;
+    currentID = vn;
+    sr = vn - imr;
+    redraw = true;
+  }
+  else if ( (cr > imr) && ((sr + cr) > vn) ) {
+    //  pan whole menu to top
+    cr = 1;
+    currentID = 1;
+    sr = 0;
+    redraw = true;
+  }
+  else if ((cr > imr) && (sr >= 0))   {
+    // scroll whole list up one by one
+    sr++;
+    cr = imr;
+    redraw = true;
+  }
+  else if ((cr < 1) && (sr > 0))   {
+    // scroll whole list down one by one
+    sr--;
+    cr = 1;
+    redraw = true;
+  }
+
+}
+
+void ItemMenu::paintItems() {
+
+  if (gc > 0) {
+    paintTiles();
+    return;
+  }
+
+  MENU_PROBE(PROF_ITEMS);
+
+  // determine if we need arrows
+  if (cr == imr) {
+    moredown = true;
+  }
+  if (cr == 1) {
+    moreup = true;
+  }
+
+  // determine if we need to redraw the header and draw
+  if ((currentID == 0) && (cr == 0)) {
+    drawHeader(true, 0);
+  }
+  else if ((pr == 0) && (cr > 0)) {
+    drawHeader(false, 0);
+  }
+
+  if ((slides > 0) && (fr.period == 0) && (!redraw) && (!enabletouch) && (d != ls) && (pr > 0) && (cr > 0) && (pr != cr) &&
+      (pr <= imr) && (cr <= imr)) {
+    slideBar(pr, cr);
+  }
+
+  d->setFont(itemf);
+
+  // now draw the items in the rows
+  for (i = 1; i <= imr; i++) {
+    paintLine(i);
+  }
+
+  moreup = false;
+  moredown = false;
+  pr = cr;
+
+}
+
+// one row of the list as paintItems draws it, moreup/moredown and redraw set by the caller
+void ItemMenu::paintLine(int Row) {
+
+  int bs;
+
+  // menu bar start
+  bs = icox + iconW(Row + sr) + isx;
+
+  // text start
+  itx = bs + iox;
+  touched(icox, isy - irh + (irh * Row), irw - icox, irh);
+
+  if (enablestate[at(Row + sr)]) {
+    temptColor = itc;
+  }
+  else {
+    temptColor = ditc;
+  }
+
+  if (redraw) {
+    // scroll so blank out every row including icon since row will get scrolled
+    fill(d, icox, isy - irh + (irh * Row), irw - icox, irh, ibc); // back color
+  }
+
+  if (Row == pr) {
+    // maybe just row change so blank previous
+    fill(d, bs, isy - irh + (irh * pr) , irw - bs, irh, ibc); // back color
+  }
+
+  if ((Row == cr) && (!enabletouch)) {
+
+    if (radius > 0) {
+      fillRound(d, bs,      isy - irh + (irh * Row) ,      irw - bs,       irh,        radius,   bcolor);
+      fillRound(d, bs + thick,  isy - irh + (irh * Row) + thick, irw - bs - (2 * thick),  irh - (2 * thick),  radius,   ihbc);
+    }
+    else {
+      fill(d, bs,       isy - irh + (irh * Row) ,      irw - bs  ,        irh, bcolor);
+      fill(d, bs + thick ,  isy - irh + (irh * Row) + thick, irw - bs - (2 * thick) , irh - (2 * thick), ihbc);
+    }
+
+
+    if (moreup) {
+      d->fillTriangle(irw - 8 - thick,              isy - irh + (irh * Row) + irh - (irh / TRIANGLE_H),
+                      irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * Row) + (irh / TRIANGLE_H),
+                      irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * Row) + irh - (irh / TRIANGLE_H), ihtc);
+    }
+    if (moredown) {
+      d->fillTriangle(irw - 8 - thick,                 isy - irh + (irh * Row) + (irh / TRIANGLE_H),
+                      irw - ((irh / TRIANGLE_W)*.5) - 8 - thick, isy - irh + (irh * Row) + irh - (irh / TRIANGLE_H),
+                      irw - (irh / TRIANGLE_W) - 8 - thick,    isy - irh + (irh * Row) + (irh / TRIANGLE_H),     ihtc);
+    }
+    temptColor = ihtc;
+
+  }
+
+  // write bitmap
+
+  if (iconType(Row + sr) == ICON_MONO) {
+    drawMonoBitmap(icox,  icoy + isy - irh + (irh * Row), monoBitmap(Row + sr), iconW(Row + sr), iconH(Row + sr), itc );
+  }
+  else if (iconType(Row + sr) == ICON_565) {
+    draw565Bitmap(icox,  icoy + isy - irh + (irh * Row), colorBitmap(Row + sr), iconW(Row + sr), iconH(Row + sr) );
+  }
+  else if (iconType(Row + sr) == ICON_PACKED) {
+    drawPackedBitmap(icox,  icoy + isy - irh + (irh * Row), monoBitmap(Row + sr), iconW(Row + sr), iconH(Row + sr) );
+  }
+  else if (iconType(Row + sr) == ICON_ATLAS) {
+    drawAtlasIcon(icox,  icoy + isy - irh + (irh * Row), Row + sr, itc);
+  }
+
+  // write text
+  d->setTextColor(temptColor);
+  d->setCursor(itx , isy - irh + (irh * Row) + ioy);
+  printLabel(d, Row + sr);
+
+}
+
+void ItemMenu::MoveUp() {
+
+  int n;
+
+  if (wake()) {
+    return;
+  }
+
+  if (gc > 0) {
+    gridGo(-gc);
+    return;
+  }
+
+  cr--;
+
+  currentID--;
+
+  update();
+
+  // at most one lap, the header may be disabled too
+  for (n = 0; (enablestate[at(currentID)] == false) && (n < vn); n++) {
+    cr--;
+    currentID--;
+    update();
+  }
+}
+
+void ItemMenu::MoveDown() {
+
+  int n;
+
+  if (wake()) {
+    return;
+  }
+
+  if (gc > 0) {
+    gridGo(gc);
+    return;
+  }
+
+  cr++;
+  currentID++;
+  update();
+  // at most one lap, the header may be disabled too
+  for (n = 0; (enablestate[at(currentID)] == false) && (n < vn); n++) {
+    cr++;
+    currentID++;
+    update();
+  }
+
+}
+
+void ItemMenu::setHighlightSlide(uint8_t Steps, uint16_t Millis) {
+  slides = Steps;
+  slidems = Millis;
+}
+
+// an atlas past 0xFF or MENU_GLYPHS glyphs is not taken
+void ItemMenu::setGlyphs(const MenuGlyphs *Glyphs) {
+  glyphs = glyphsFit(Glyphs) ? Glyphs : nullptr;
+}
+
+void ItemMenu::setIconAtlas(const MenuIconAtlas *Atlas) {
+  atlas = Atlas;
+}
+
+void ItemMenu::setItemIcon(int ID, uint8_t Icon) {
+  if ((ID < 1) || (ID >= MAX_OPT)) return;
+  aicon[ID] = Icon;
+}
+
+// moves the highlight bar from row From to row To in slides steps, each step only repaints
+// the band the bar leaves and the band it covers, a step that runs past its share of slidems
+// makes the next one the last
+void ItemMenu::slideBar(int From, int To) {
+
+  int16_t x0 = view.w ? icox : min(icox, isx);
+  int16_t y0 = isy - irh + (irh * From);
+  int16_t y1 = isy - irh + (irh * To);
+  int16_t yb = y0, yn;
+  uint32_t t0 = millis(), due, now;
+  int k;
+
+  if (!strip) {
+    strip = new GFXcanvas1(irw - x0, irh);
+  }
+  if ((!strip) || (!strip->getBuffer())) {
+    return;
+  }
+
+  // the bar loses its border and arrows while it moves
+  paintBand(y0, y0 + irh, true);
+
+  for (k = 1; k <= slides; k++) {
+    yn = y0 + (((int32_t) (y1 - y0) * k) / slides);
+    if (yn > yb) {
+      paintBand(yb, min(yn, (int16_t) (yb + irh)), false);
+      paintBand(max((int16_t) (yb + irh), yn), yn + irh, true);
+    }
+    else if (yn < yb) {
+      paintBand(yn, min((int16_t) (yn + irh), yb), true);
+      paintBand(max((int16_t) (yn + irh), yb), yb + irh, false);
+    }
+    yb = yn;
+
+    if (k == slides) {
+      break;
+    }
+    due = ((uint32_t) slidems * k) / slides;
+    now = millis() - t0;
+    if (now < due) {
+      delay(due - now);
+    }
+    else {
+      k = slides - 1;
+    }
+  }
+
+}
+
+// repaints rows Y0 to Y1 of the list, the part of each row right of its icon, as highlight or not
+void ItemMenu::paintBand(int16_t Y0, int16_t Y1, bool hl) {
+
+  int16_t x0 = view.w ? icox : min(icox, isx);
+  int16_t top, a, b;
+  int r, id, bs;
+  uint16_t tc;
+
+  strip->setFont(itemf);
+  strip->setTextWrap(false);
+
+  for (r = 1; r <= imr; r++) {
+    top = isy - irh + (irh * r);
+    a = max(Y0, top);
+    b = min(Y1, (int16_t) (top + irh));
+    if (b <= a) {
+      continue;
+    }
+    id = r + sr;
+    bs = icox + iconW(id) + isx;
+    tc = enablestate[at(id)] ? itc : ditc;
+
+    strip->fillScreen(0);
+    strip->setCursor(bs + iox - x0, ioy);
+    printLabel(strip, id);
+
+    blitBand(tft, cv, strip, x0, top, bs - x0, a - top, b - a, hl ? ihtc : tc, hl ? ihbc : ibc);
+    touched(bs, a, irw - bs, b - a);
+  }
+
+}
+
+void ItemMenu::MoveLeft() {
+
+  if (wake()) {
+    return;
+  }
+
+  if (gc > 0) {
+    gridGo(-1);
+    return;
+  }
+  MoveUp();
+
+}
+
+void ItemMenu::MoveRight() {
+
+  if (wake()) {
+    return;
+  }
+
+  if (gc > 0) {
+    gridGo(1);
+    return;
+  }
+  MoveDown();
+
+}
+
+void ItemMenu::setGrid(uint8_t Columns, uint8_t Rows, uint16_t CellHeight) {
+
+  gc = Columns;
+  gr = (Rows > 0) ? Rows : 1;
+  gch = CellHeight;
+  sr = 0;
+  if (gc == 0) {
+    // back to a list, the highlight stays on its item
+    if ((currentID < 0) || (currentID > vn)) {
+      currentID = 0;
+    }
+    sr = (currentID > (int) imr) ? currentID - imr : 0;
+    cr = currentID - sr;
+    pr = cr;
+  }
+
+}
+
+// the item a step away from ID in the grid, Step is 1 or gc either way, the header (0)
+// sits above the first row and before the first item
+int ItemMenu::gridNext(int ID, int Step) {
+
+  int row, last;
+
+  if (Step == 1) {
+    return (ID >= vn) ? 0 : ID + 1;
+  }
+  if (Step == -1) {
+    return (ID <= 0) ? vn : ID - 1;
+  }
+  if (ID == 0) {
+    return (Step > 0) ? 1 : vn;
+  }
+
+  row = (ID - 1) / gc;
+  last = (vn - 1) / gc;
+
+  if (Step > 0) {
+    if (row >= last) {
+      return 0;
+    }
+    // the last row can be short
+    return min(ID + gc, vn);
+  }
+  if (row == 0) {
+    return 0;
+  }
+  return ID - gc;
+
+}
+
+// true if some item in the list is enabled
+bool ItemMenu::gridAny() {
+
+  int k;
+
+  for (k = 1; k <= vn; k++) {
+    if (enablestate[at(k)]) {
+      return true;
+    }
+  }
+  return false;
+
+}
+
+void ItemMenu::gridGo(int Step) {
+
+  int id = currentID;
+  int n = 0;
+
+  // nothing to land on, the highlight stays
+  if (!gridAny()) {
+    return;
+  }
+
+  do {
+    id = gridNext(id, Step);
+    n++;
+  } while ((!enablestate[at(id)]) && (n <= vn));
+
+  gridSelect(id);
+
+}
+
+// moves the highlight to ID, only the two cells change unless the page does
+void ItemMenu::gridSelect(int ID) {
+
+  int old = currentID;
+  int top = sr;
+
+  if (ID > 0) {
+    top = ((ID - 1) / (gc * gr)) * (gc * gr);
+  }
+  currentID = ID;
+
+  if (top != sr) {
+    sr = top;
+    if (fr.period > 0) {
+      pendnav = true;
+      pendrow[old] = BUTTON_NOTPRESSED + 1;
+      fr.request();
+    }
+    else {
+      paintTiles();
+      // the header is not part of the page
+      if (old == 0) {
+        paintTile(0, BUTTON_NOTPRESSED);
+      }
+    }
+    return;
+  }
+
+  if (old == ID) {
+    return;
+  }
+  if (fr.period > 0) {
+    pendrow[old] = BUTTON_NOTPRESSED + 1;
+    pendrow[ID] = BUTTON_NOTPRESSED + 1;
+    fr.request();
+  }
+  else {
+    paintTile(old, BUTTON_NOTPRESSED);
+    paintTile(ID, BUTTON_NOTPRESSED);
+  }
+
+}
+
+void ItemMenu::gridPage(int Dir) {
+
+  int page = gc * gr;
+  int top = sr + (Dir * page);
+  int id, n = 0;
+
+  if (!gridAny()) {
+    return;
+  }
+
+  if (top < 0) {
+    top = ((vn - 1) / page) * page;
+  }
+  else if (top >= vn) {
+    top = 0;
+  }
+  // the first item of the page, or the next enabled one after it
+  id = top + 1;
+  while ((!enablestate[at(id)]) && (n <= vn)) {
+    id = gridNext(id, 1);
+    n++;
+  }
+  gridSelect(id);
+
+}
+
+void ItemMenu::paintTiles() {
+
+  MENU_PROBE(PROF_ITEMS);
+
+  int k;
+
+  if (currentID > vn) {
+    currentID = 0;
+  }
+  if (currentID > 0) {
+    sr = ((currentID - 1) / (gc * gr)) * (gc * gr);
+  }
+  if ((currentID == 0) && (!enabletouch)) {
+    drawHeader(true, 0);
+  }
+  for (k = 1; k <= gc * gr; k++) {
+    paintTile(sr + k, BUTTON_NOTPRESSED);
+  }
+
+}
+
+// one grid cell, the icon centered at the top and the label at the item text margins
+void ItemMenu::paintTile(int ID, uint8_t style) {
+
+  MENU_PROBE(PROF_ROW);
+
+  int k = ID - sr - 1;
+  int16_t cw, cx, cy;
+  bool hl;
+
+  if (ID == 0) {
+    drawHeader((currentID == 0) && (!enabletouch), style);
+    return;
+  }
+  if ((k < 0) || (k >= gc * gr)) {
+    // not on this page
+    return;
+  }
+
+  cw = (irw - view.x - isx) / gc;
+  cx = view.x + isx + ((k % gc) * cw);
+  cy = isy + ((k / gc) * gch);
+  touched(cx, cy, cw, gch);
+  hl = (style == BUTTON_PRESSED) || ((ID == currentID) && (!enabletouch));
+
+  if (hl) {
+    if (radius > 0) {
+      fillRound(d, cx, cy, cw, gch, radius, bcolor);
+      fillRound(d, cx + thick, cy + thick, cw - (2 * thick), gch - (2 * thick), radius, ihbc);
+    }
+    else {
+      fill(d, cx, cy, cw, gch, bcolor);
+      fill(d, cx + thick, cy + thick, cw - (2 * thick), gch - (2 * thick), ihbc);
+    }
+  }
+  else {
+    fill(d, cx, cy, cw, gch, ibc);
+  }
+
+  if (ID > vn) {
+    return;
+  }
+
+  if (!enablestate[at(ID)]) {
+    temptColor = ditc;
+  }
+  else if (hl) {
+    temptColor = ihtc;
+  }
+  else {
+    temptColor = itc;
+  }
+
+  if (iconType(ID) == ICON_MONO) {
+    drawMonoBitmap(cx + ((cw - iconW(ID)) / 2), cy + icoy, monoBitmap(ID), iconW(ID), iconH(ID), temptColor);
+  }
+  else if (iconType(ID) == ICON_565) {
+    draw565Bitmap(cx + ((cw - iconW(ID)) / 2), cy + icoy, colorBitmap(ID), iconW(ID), iconH(ID));
+  }
+  else if (iconType(ID) == ICON_PACKED) {
+    drawPackedBitmap(cx + ((cw - iconW(ID)) / 2), cy + icoy, monoBitmap(ID), iconW(ID), iconH(ID));
+  }
+  else if (iconType(ID) == ICON_ATLAS) {
+    drawAtlasIcon(cx + ((cw - iconW(ID)) / 2), cy + icoy, ID, temptColor);
+  }
+
+  d->setFont(itemf);
+  d->setTextColor(temptColor);
+  d->setCursor(cx + iox, cy + ioy);
+  printLabel(d, ID, cx + cw);
+
+}
+
+#if MENU_FILTER
+/*
+
+  filter, setFilter and filterKey narrow the list to the items whose label starts with (or has,
+  with Substring) the text, letters match either case. while a filter is on the list places
+  1 - vn are the matching items vis[1..vn] in item order, the row drawing works on places and
+  at() turns a place into the item, totalID stays how many items there are. mlen is how
+  much of the text each item matched, a new character only looks at the items that matched
+  all of the text before it (and for a substring from mpos, where that match was), taking a
+  character off takes back the items that matched that far without looking at any labels
+
+*/
+
+static char foldChar(char c) {
+  return ((c >= 'A') && (c <= 'Z')) ? (c + ('a' - 'A')) : c;
+}
+
+int ItemMenu::setFilter(const char *Text, bool Substring) {
+
+  int shown[MAX_OPT];
+  int r, id, rows = imr, hl = cr, was = at(currentID);
+  uint8_t k = 0;
+
+  if (filt && (fsub == Substring)) {
+    while ((k < fn) && (Text[k] == fq[k])) {
+      k++;
+    }
+  }
+  // what the rows show now, to draw only the ones that change
+  for (r = 1; r <= imr; r++) {
+    shown[r] = ((r + sr) <= vn) ? at(r + sr) : 0;
+  }
+
+  if (!filt) {
+    fn = 0;
+    filt = true;
+  }
+  fsub = Substring;
+
+  // back to the part of the text that stays
+  if (fn > k) {
+    fn = k;
+    vn = 0;
+    for (id = 1; id <= totalID; id++) {
+      if (mlen[id] >= fn) {
+        mlen[id] = fn;
+        mpos[id] = 0;
+        vis[++vn] = id;
+      }
+    }
+  }
+  if (fn == 0) {
+    for (id = 1; id <= totalID; id++) {
+      mlen[id] = 0;
+      mpos[id] = 0;
+      vis[id] = id;
+    }
+    vn = totalID;
+  }
+  fq[fn] = 0;
+
+  // and on a character at a time
+  while (Text[fn] && (fn < (MAX_CHAR_LEN - 1))) {
+    fq[fn] = Text[fn];
+    fn++;
+    fq[fn] = 0;
+    k = 0;
+    for (r = 1; r <= vn; r++) {
+      id = vis[r];
+      if (labelMatch(id)) {
+        mlen[id] = fn;
+        vis[++k] = id;
+      }
+    }
+    vn = k;
+  }
+
+  if (fn == 0) {
+    // no text, the whole list again
+    filt = false;
+    vn = totalID;
+  }
+
+  // the highlight stays on its item if it still matches, else goes to the first match
+  imr = fimr;
+  if (imr > vn) {
+    imr = vn;
+  }
+  r = place(was);
+  if (r < 0) {
+    r = (vn > 0) ? 1 : 0;
+  }
+  currentID = r;
+  sr = (r > (int) imr) ? r - imr : 0;
+  cr = r - sr;
+  pr = cr;
+  // a drag or flick was over the old list, a finger still down drags the new one
+  scroll.press(ty, sr * irh, (vn <= imr) ? sr * irh : (vn - imr) * irh);
+  clearPending();
+
+  if (idle) {
+    stale = true;
+    return vn;
+  }
+
+  drawHeader((currentID == 0) && (!enabletouch), 0);
+  if (gc > 0) {
+    paintTiles();
+    return vn;
+  }
+
+  d->setFont(itemf);
+  moreup = (cr == 1);
+  moredown = (cr == imr);
+  redraw = true;
+  for (r = 1; r <= max(rows, (int) imr); r++) {
+    id = ((r <= imr) && ((r + sr) <= vn)) ? at(r + sr) : 0;
+    // the highlight row also when its down arrow comes or goes
+    if ((r <= rows) && (id == shown[r]) && ((r == cr) == (r == hl)) && ((r != cr) || (rows == (int) imr))) {
+      continue;
+    }
+    if (id == 0) {
+      fill(d, icox, isy - irh + (irh * r), irw - icox, irh, ibc);
+      touched(icox, isy - irh + (irh * r), irw - icox, irh);
+      continue;
+    }
+    paintLine(r);
+  }
+  redraw = false;
+  moreup = false;
+  moredown = false;
+
+  return vn;
+
+}
+
+#endif
+
+// a new item, while a filter is on it joins the list if its label has all of the text
+void ItemMenu::listNew() {
+
+#if MENU_FILTER
+  uint8_t n = fn;
+
+  if (filt) {
+    mlen[totalID] = 0;
+    mpos[totalID] = 0;
+    for (fn = 1; (fn <= n) && labelMatch(totalID); fn++) {
+      mlen[totalID] = fn;
+    }
+    fn = n;
+    if (mlen[totalID] == fn) {
+      vis[++vn] = totalID;
+    }
+  }
+  else {
+    vn = totalID;
+  }
+#else
+  vn = totalID;
+#endif
+  // a row back if the list had run short
+  if ((imr < fimr) && ((int) imr < vn)) {
+    imr++;
+  }
+
+}
+
+#if MENU_FILTER
+// a character typed into the filter, a backspace ('\b') takes the last one off
+int ItemMenu::filterKey(char Key) {
+
+  char buf[MAX_CHAR_LEN];
+
+  strcpy(buf, filt ? fq : "");
+  if (Key == '\b') {
+    if (fn > 0) {
+      buf[fn - 1] = 0;
+    }
+  }
+  else if (fn < (MAX_CHAR_LEN - 1)) {
+    buf[fn] = Key;
+    buf[fn + 1] = 0;
+  }
+  return setFilter(buf, fsub);
+
+}
+
+const char *ItemMenu::getFilter() {
+  return filt ? fq : "";
+}
+#endif
+
+// the title bar text, the filter while one is on
+const char *ItemMenu::titleText() {
+#if MENU_FILTER
+  if (filt) return fq;
+#endif
+  return ttx;
+}
+
+// item at list place Pos
+int ItemMenu::at(int Pos) {
+#if MENU_FILTER
+  return (filt && (Pos > 0) && (Pos <= vn)) ? vis[Pos] : Pos;
+#else
+  return Pos;
+#endif
+}
+
+// list place of item ID, -1 if it is filtered out
+int ItemMenu::place(int ID) {
+
+#if MENU_FILTER
+  int p;
+
+  if ((!filt) || (ID <= 0)) {
+    return ID;
+  }
+  for (p = 1; p <= vn; p++) {
+    if (vis[p] == ID) {
+      return p;
+    }
+  }
+  return -1;
+#else
+  return ID;
+#endif
+
+}
+
+#if MENU_FILTER
+
+// character K of the label of item ID, 0 past the end
+char ItemMenu::labelChar(int ID, uint8_t K) {
+
+  if (defs) {
+    if (rlabel[ID]) {
+      return rlabel[ID][K];
+    }
+    return pgm_read_byte((const char *) pgm_read_ptr(&defs[ID - 1].label) + K);
+  }
+#if MENU_ITEM_RAM
+  return itemlabel[ID][K];
+#else
+  return 0;
+#endif
+
+}
+
+// item ID matched the first fn - 1 characters of the filter, does it match all fn
+bool ItemMenu::labelMatch(int ID) {
+
+  uint8_t p = mpos[ID], j;
+
+  if (!fsub) {
+    return foldChar(labelChar(ID, fn - 1)) == foldChar(fq[fn - 1]);
+  }
+  // the first place at or past the last match that has the whole text
+  while (labelChar(ID, p)) {
+    for (j = 0; (j < fn) && (foldChar(labelChar(ID, p + j)) == foldChar(fq[j])); j++) {
+    }
+    if (j == fn) {
+      mpos[ID] = p;
+      return true;
+    }
+    p++;
+  }
+  return false;
+
+}
+#endif
+
+void ItemMenu::update() {
+
+  if (fr.period == 0) {
+    drawItems();
+    return;
+  }
+
+  // frame rate set, just move and let tick() draw
+  scrollItems();
+  pendredraw = pendredraw || redraw;
+  pendnav = true;
+  fr.request();
+
+}
+
+void ItemMenu::setFrameRate(uint8_t FramesPerSecond) {
+  fr.setRate(FramesPerSecond);
+  clearPending();
+}
+
+void ItemMenu::clearPending() {
+  fr.pending = false;
+  pendnav = false;
+  pendredraw = false;
+  pendscroll = false;
+  memset(pendrow, 0, sizeof(pendrow));
+}
+
+const MenuFrames &ItemMenu::getFrameStats() {
+  return fr;
+}
+
+// goes idle after Timeout ms with no input, 0 never, Hook is called with true once the display
+// is off and with false when it is back, for a backlight or to let the sketch sleep the MCU
+void ItemMenu::setIdle(uint32_t Timeout, uint8_t Mode, void (*Hook)(bool Idle)) {
+  idlems = Timeout;
+  idlemode = Mode;
+  idlehook = Hook;
+  lastinput = millis();
+}
+
+bool ItemMenu::isIdle() {
+  return idle;
+}
+
+const MenuIdleStats &ItemMenu::getIdleStats() {
+  return ist;
+}
+
+// as EditMenu::memoryReport
+void ItemMenu::memoryReport(Print &Out) {
+
+  size_t n = 0;
+
+  Out.print(F("ItemMenu "));
+  Out.println((unsigned long) sizeof(ItemMenu));
+  MENU_MEM(value);
+#if MENU_ITEM_RAM
+  MENU_MEM(itemlabel);
+  MENU_MEM(itemBitmap);
+  MENU_MEM(item565Bitmap);
+  MENU_MEM(bmp_w);
+  MENU_MEM(bmp_h);
+  MENU_MEM(IconType);
+#endif
+  MENU_MEM(rlabel);
+  MENU_MEM(enablestate);
+  MENU_MEM(pendrow);
+  MENU_MEM(aicon);
+#if MENU_FILTER
+  MENU_MEM(vis);
+  MENU_MEM(mlen);
+  MENU_MEM(mpos);
+#endif
+  memLine(Out, F("per item"), n / MAX_OPT);
+  MENU_MEM(ttx);
+  MENU_MEM(etx);
+#if MENU_FILTER
+  MENU_MEM(fq);
+#endif
+  MENU_MEM(dmg);
+  MENU_MEM(scroll);
+  MENU_MEM(fr);
+  memLine(Out, F("other"), sizeof(ItemMenu) - n);
+
+}
+
+// puts the menu in the W x H rectangle at X, Y and keeps it there, the title bar takes the top
+// of it and the layout moves over with its margins kept, rows that no longer fit are dropped,
+// call it after the other layout setters and before draw
+void ItemMenu::setViewport(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  int16_t rm = tbl + tbw - irw;  // right margin of the rows
+  int16_t fit;
+
+  isy += Y - tbt;
+  icox += X - tbl;
+  tbl = X;
+  tbt = Y;
+  tbw = W;
+  irw = X + W - rm;
+
+  fit = max((Y + H - (int16_t) isy) / (int16_t) irh, 0);
+  if (fit < fimr) {
+    fimr = fit;
+  }
+  if (fit < imr) {
+    imr = fit;
+  }
+  if (gc > 0) {
+    fit = max((Y + H - (int16_t) isy) / (int16_t) gch, 0);
+    if (fit < gr) {
+      gr = fit;
+    }
+  }
+
+  view.x = X;
+  view.y = Y;
+  view.w = W;
+  view.h = H;
+
+  dropStrip();
+
+}
+
+// rectangles drawn since clearDamage, merged once there are more than MENU_DAMAGE of them
+uint8_t ItemMenu::getDamage(const MenuRect *&Rects) {
+  Rects = dmg;
+  return ndmg;
+}
+
+void ItemMenu::clearDamage() {
+  ndmg = 0;
+}
+
+// draws into Canvas from now on, flush it to put the menu on the panel, nullptr draws on the panel again
+void ItemMenu::setCanvas(MenuCanvas *Canvas) {
+  cv = Canvas;
+  d = Canvas ? (Adafruit_GFX *) Canvas : tft;
+}
+
+// draw() records into List and only what changed since the last draw goes out, make the list
+// with the same canvas as the menu, nullptr draws straight away again
+void ItemMenu::setList(MenuList *List) {
+  ls = List;
+}
+
+// the title text cut at the end of the title bar inside a viewport
+void ItemMenu::printTitle(const char *Text) {
+
+  if (view.w == 0) {
+    d->print(Text);
+    return;
+  }
+  d->write((const uint8_t *) Text, textFit(titlef, nullptr, Text, tbl + tbw - d->getCursorX()));
+
+}
+
+// notes a rectangle about to be drawn, the part on the screen goes in the damage list
+void ItemMenu::touched(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+  MenuRect r;
+
+  r.x = max(X, (int16_t) 0);
+  r.y = max(Y, (int16_t) 0);
+  r.w = min((int16_t) (X + W), d->width()) - r.x;
+  r.h = min((int16_t) (Y + H), d->height()) - r.y;
+  if ((r.w > 0) && (r.h > 0)) {
+    addDamage(dmg, ndmg, r);
+  }
+  if ((ls) && (d != ls)) {
+    // drawn past the list, the screen no longer shows its last draw
+    ls->invalidate();
+  }
+
+}
+
+void ItemMenu::goIdle() {
+
+  uint32_t t0 = micros();
+
+  idle = true;
+  // a frame still waiting goes out with the wake
+  stale = fr.pending;
+  if (cv) {
+    cv->drain();
+  }
+  tft->enableDisplay(false);
+  if (idlemode == IDLE_SLEEP) {
+    tft->enableSleep(true);
+  }
+  ist.entries++;
+  ist.enterus = micros() - t0;
+  if (idlehook) {
+    idlehook(true);
+  }
+
+}
+
+// counts as input, and when idle brings the display back, the panel kept its picture so it
+// is only redrawn if something was drawn or changed while idle, returns true if the menu was
+// idle so the input that woke it can be dropped
+bool ItemMenu::wake() {
+
+  uint32_t t0, t;
+
+  lastinput = millis();
+  if (!idle) {
+    return false;
+  }
+
+  t0 = micros();
+  idle = false;
+  if (cv) {
+    cv->drain();
+  }
+  if (idlemode == IDLE_SLEEP) {
+    tft->enableSleep(false);
+    // sleep out needs 5 ms before the next command
+    delay(5);
+  }
+  if (stale || fr.pending) {
+    draw();
+  }
+  stale = false;
+  if (cv) {
+    // the panel comes back with the frame it missed
+    cv->flush();
+    cv->drain();
+  }
+  tft->enableDisplay(true);
+  t = micros() - t0;
+  ist.wakeus = t;
+  if (t > ist.maxwakeus) {
+    ist.maxwakeus = t;
+  }
+  if (idlehook) {
+    idlehook(false);
+  }
+  return true;
+
+}
+
+bool ItemMenu::tick() {
+
+  MENU_PROBE(PROF_TICK);
+
+  int id;
+
+  if (idle) {
+    return false;
+  }
+  if ((idlems > 0) && ((millis() - lastinput) >= idlems)) {
+    goIdle();
+    return false;
+  }
+
+  updateScroll();
+
+  if (!fr.due()) {
+    return false;
+  }
+
+  if (pendscroll) {
+    drawScroll();
+  }
+
+  // all the moves since the last frame go out as one
+  if ((pendnav) && (enablestate[at(currentID)])) {
+    redraw = pendredraw;
+    paintItems();
+  }
+
+  for (id = 0; id <= vn; id++) {
+    if (pendrow[id]) {
+      paintRow(id, pendrow[id] - 1);
+      pendrow[id] = 0;
+    }
+  }
+
+  pendnav = false;
+  pendredraw = false;
+  pendscroll = false;
+  fr.drawn();
+  return true;
+
+}
+
+int ItemMenu::selectRow() {
+
+  if (wake()) {
+    return -1;
+  }
+  if (currentID == 0) {
+    cr = 0;
+    sr = 0;
+  }
+  item = at(currentID);
+  return item;
+}
+
+void ItemMenu::setTitleColors( uint16_t TitleTextColor, uint16_t TitleFillColor) {
+  ttc = TitleTextColor;
+  tfc = TitleFillColor;
+
+}
+
+void ItemMenu::setTitleBarSize( uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight) {
+
+  tbt = TitleTop;
+  tbl = TitleLeft;
+  tbw = TitleWith;
+  tbh = TitleHeight;
+
+}
+
+void ItemMenu::setTitleText(char *TitleText, char *ExitText) {
+  strncpy(ttx, TitleText, MAX_CHAR_LEN);
+  strncpy(etx, ExitText, MAX_CHAR_LEN);
+}
+
+void ItemMenu::setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin) {
+  tox = LeftMargin;   // pixels to offset text in menu bar
+  toy = TopMargin;   // pixels to offset text in menu bar
+}
+
+void ItemMenu::setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, byte BorderRadius, byte BorderThickness) {
+  isx = LeftMargin;  // pixels to offset text in menu bar
+  irw = Width - isx;  // pixels to offset text in menu bar
+  radius = BorderRadius;
+  thick = BorderThickness;
+  dropStrip();
+
+}
+
+void ItemMenu::setItemColors(uint16_t DisableTextColor, uint16_t BorderColor) {
+  ditc = DisableTextColor;
+  bcolor = BorderColor;
+}
+
+
+void ItemMenu::SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, uint16_t HighlightTextColor, uint16_t HighlightColor, 
+		uint16_t HighLightBorderColor, uint16_t DisableTextColor, uint16_t TitleTextColor, uint16_t TitleFillColor) {
+
+	itc = TextColor;
+	ibc = BackgroundColor;
+	ihtc = HighlightTextColor;
+	ihbc = HighlightColor;
+	bcolor = HighLightBorderColor;
+	ttc = TitleTextColor;
+	tfc = TitleFillColor;
+	ditc = DisableTextColor;
+	
+	}
+
+void ItemMenu::setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin) {
+  iox = LeftMargin;  // pixels to offset text in menu bar
+  ioy = TopMargin;  // pixels to offset text in menu bar
+  mm = MenuMargin;
+  isy = tbt + tbh + mm;
+}
+
+void ItemMenu::setItemText(int ID, const char *ItemText) {
+  if ((ID < 1) || (ID > totalID)) {
+    return;
+  }
+  if (defs) {
+    // tables are read only, keep the caller's string instead
+    rlabel[ID] = ItemText;
+  }
+#if MENU_ITEM_RAM
+  else {
+    strncpy(itemlabel[ID], ItemText, MAX_CHAR_LEN - 1);
+    itemlabel[ID][MAX_CHAR_LEN - 1] = 0;
+  }
+#endif
+  drawRow(ID, BUTTON_NOTPRESSED);
+}
+
+void ItemMenu::setIconMargins(uint16_t IconOffsetX, uint16_t IconOffsetY) {
+  icox = IconOffsetX; // pixels to offset text in menu bar
+  icoy = IconOffsetY;  // pixels to offset text in menu bar
+  dropStrip();
+}
+
+void ItemMenu::disable(int ID) {
+  enablestate[ID] = false;
+}
+
+void ItemMenu::enable(int ID) {
+  enablestate[ID] = true;
+}
+
+bool ItemMenu::getEnableState(int ID) {
+  return enablestate[ID];
+}
+
+
+void ItemMenu::drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color) {
+
+  MENU_PROBE(PROF_MONO);
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_MONO, bitmap, w, 0, 0, w, h, color);
+    return;
+  }
+
+  uint8_t sbyte = 0;
+  uint8_t byteWidth = 0;
+  int jj, ii;
+
+  byteWidth = (w + 7) / 8;
+
+  for (jj = 0; jj < h; jj++) {
+    for (ii = 0; ii < w; ii++) {
+      if (ii & 7)  sbyte <<= 1;
+      else sbyte   = pgm_read_byte(bitmap + jj * byteWidth + ii / 8);
+      if (sbyte & 0x80) {
+        d->drawPixel(x + ii, y + jj, color);
+        MENU_PIXELS(1);
+      }
+    }
+  }
+
+}
+
+void ItemMenu::draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h) {
+
+  MENU_PROBE(PROF_565);
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_565, bitmap, w, 0, 0, w, h, 0);
+    return;
+  }
+
+  uint32_t offset = 0;
+
+  int j, i;
+
+  for (i = 0; i < h; i++) {
+    for (j = 0; j < w; j++) {
+      d->drawPixel(j + x, i + y, pgm_read_word_near(bitmap + offset));
+      offset++;
+    }
+  }
+  MENU_PIXELS((uint32_t) w * h);
+
+}
+
+// draws a packed icon, on screen a run goes out as one fill and runs wrap rows inside the
+// address window by themselves, a clipped icon falls back to pixels
+void ItemMenu::drawPackedBitmap(int16_t x, int16_t y, const unsigned char *Bitmap, uint8_t w, uint8_t h) {
+
+  MENU_PROBE(PROF_PACKED);
+
+  MenuUnpack pk = {};
+  MenuBurst b = {};
+  uint32_t total = (uint32_t) w * h, k;
+  int j, i;
+
+  if (d == ls) {
+    // one op in the list, drawn when the list goes out
+    ls->icon(x, y, ICON_PACKED, Bitmap, w, 0, 0, w, h, 0);
+    return;
+  }
+
+  pk.begin(Bitmap);
+
+  if ((x >= 0) && (y >= 0) && ((x + w) <= d->width()) && ((y + h) <= d->height())) {
+    b.begin(tft, cv, x, y, w, h);
+    for (k = total; k > 0; k -= pk.left) {
+      pk.run();
+      if (pk.left > k) {
+        pk.left = k;
+      }
+      b.color(pk.color, pk.left);
+    }
+    b.end();
+  }
+  else {
+    for (i = 0; i < h; i++) {
+      for (j = 0; j < w; j++) {
+        d->drawPixel(j + x, i + y, pk.next());
+      }
+    }
+  }
+  MENU_PIXELS(total);
+
+}
+
+/////////////////////////////////
+// end of this menu library
+/////////////////////////////////
@@ -1,311 +1,1474 @@
-/*
-  The MIT License (MIT)
-
-  library writen by Kris Kasprzak
-  
-  Permission is hereby granted, free of charge, to any person obtaining a copy of
-  this software and associated documentation files (the "Software"), to deal in
-  the Software without restriction, including without limitation the rights to
-  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
-  the Software, and to permit persons to whom the Software is furnished to do so,
-  subject to the following conditions:
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
-  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
-  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
-  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
-  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
-
-  On a personal note, if you develop an application or product using this library 
-  and make millions of dollars, I'm happy for you!
-
-	rev		date			author				change
-	1.0		1/2022			kasprzak			initial code
-	2.0   1/2022      kasprzak      added touch support
-	3.0   3/2022      kasprzak      fixed font issue with MEGA
- 	4.0   11/2023     kasprzak      fixed ability to set a value with value property (as opposed to using the SetItemValue method
-
-	// Website for generating icons
-	// https://javl.github.io/image2cpp/
-
-
-*/
-
-
-#include "Adafruit_GFX.h"
-#include "Adafruit_ST7735.h"
-
-
-#ifndef ADAFRUITST735_MENU_H
-#define ADAFRUITST735_MENU_H
-
-#if ARDUINO >= 100
-	 #include "Arduino.h"
-	 #include "Print.h"
-#else
-	
-#endif
-
-#ifdef __cplusplus
-	
-#endif
-
-#define MAX_OPT 15				// max elements in a menu, increase as needed
-#define MAX_CHAR_LEN 30			// max chars in menus, increase as needed
-#define TRIANGLE_H 3.7
-#define TRIANGLE_W 2.5
-#define MENU_C_DKGREY 0x4A49	// used for disable color, method to change
-#define EXIT_TEXT "Exit"		// default text for menu exit text, change here or use a method
-
-#define ICON_NONE 0
-#define ICON_MONO 1
-#define ICON_565  2
-
-#define  BUTTON_PRESSED 1
-#define  BUTTON_NOTPRESSED 0
-
-#define  ADAFRUIT_ST7735_MENU_VERSION 4.0
-
-class  EditMenu {
-		
-public:
-
-	EditMenu(Adafruit_ST7735 *Display,bool EnableTouch = false);
-
-	void init(uint16_t TextColor, uint16_t BackgroundColor, 
-		uint16_t HighlightTextColor, uint16_t HighlightColor,
-		uint16_t SelectedTextColor, uint16_t SelectedColor,
-		uint16_t MenuColumn, uint16_t ItemRowHeight,uint16_t MaxRow,
-		const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont);
-
-	int addNI(const char *ItemText, float Data, float LowLimit, float HighLimit, 
-		float Increment, byte DecimalPlaces = 0, const char **ItemMenuText = NULL);
-
-	int addMono(const char *ItemText, float Data, float LowLimit, float HighLimit, 
-		float Increment, byte DecimalPlaces = 0,const char **ItemMenuText = NULL, 
-		const unsigned char *Bitmap = nullptr, uint8_t BitmapWidth = 0, uint8_t BitmapHeight = 0);
-
-	int add565(const char *ItemText, float Data, float LowLimit, float HighLimit, 
-		float Increment, byte DecimalPlaces = 0, const char **ItemMenuText = NULL, 
-		const uint16_t *Bitmap = nullptr, uint8_t BitmapWidth = 0, uint8_t BitmapHeight = 0);
-	
-	int selectRow();
-
-	void draw();
-
-	void MoveUp();
-
-	void MoveDown();
-	
-	void setInitialItem(int ItemID);
-
-	void setTitleColors(uint16_t TitleTextColor, uint16_t TitleFillColor);
-
-	void setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight);
-
-	void setTitleText( char *TitleText,  char *ExitText);
-
-	void setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin);
-
-	void setIncrementDelay(uint16_t Delay);
-	
-	void setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, uint16_t BorderRadius, uint16_t BorderThickness);
-
-	void setItemColors( uint16_t DisableTextColor, uint16_t BorderColor, uint16_t EditModeBorderColor = 0);
-
-	void setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin);
-
-	void setItemText(int ItemID, const char *ItemText);
-
-	void setIconMargins(uint16_t LeftMargin, uint16_t TopMargin);
-
-	void SetItemValue(int ItemID, float ItemValue);
-
-	void SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, 
-							uint16_t HighlightTextColor, uint16_t HighlightColor, uint16_t HighlightBorderColor,
-							uint16_t SelectedTextColor, uint16_t SelectedColor, uint16_t SelectBorderColor,
-							uint16_t DisableTextColor ,	uint16_t TitleTextColor, uint16_t TitleFillColor);
-
-	void disable(int ID);
-
-	void enable(int ID);
-
-	bool getEnableState(int ID);
-	
-	int press(int16_t ScreenX, int16_t ScreenY);
-
-	void drawRow(int ID);
-		
-	float value[MAX_OPT];
-
-	int item;
-
-private:
-
-	void drawHeader(bool hl, uint8_t Style);
-
-	void up();
-
-	void down();
-
-	void incrementUp();
-	
-	void incrementDown();
-
-	void drawItems();
-
-	void drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color);
-
-	void draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h);
-	
-	Adafruit_ST7735 *d;
-	char itemlabel[MAX_OPT][MAX_CHAR_LEN];
-	char ttx[MAX_CHAR_LEN];
-	char etx[MAX_CHAR_LEN]; 
-	const GFXfont *itemf;
-	const GFXfont *titlef;
-	uint16_t itc, ibc, ihtc, ihbc, istc, isbc;	// item variables
-	uint16_t tbl, tbt, tbw, tbh, ttc, tfc, tox, toy;	// title variables
-	// margins
-	uint16_t imr, isx, itx, isy, irh, irw, ioy, iox, mm,icox, icoy;
-	int i;
-	int totalID;
-	int MaxRow;
-	int currentID;
-	int cr;
-	byte debounce;
-	int sr, pr;
-	bool moreup = false, moredown = false;
-	uint16_t col;
-	float low[MAX_OPT];
-	float high[MAX_OPT];
-	float inc[MAX_OPT];
-	byte dec[MAX_OPT];
-	char **itemtext[MAX_OPT];
-	bool rowselected = false;
-	bool haslist[MAX_OPT];
-	bool enablestate[MAX_OPT];
-	bool drawTitleFlag = true;
-	bool redraw = false;
-	uint16_t ditc = 0;
-	uint16_t temptColor = 0, bcolor, sbcolor;
-	const unsigned char	*itemBitmap[MAX_OPT];
-	const uint16_t *item565Bitmap[MAX_OPT];
-	uint8_t bmp_w[MAX_OPT];
-	uint8_t bmp_h[MAX_OPT];
-	byte IconType[MAX_OPT];
-	uint16_t  radius = 0;
-	uint16_t thick = 0;
-	uint16_t incdelay = 50;
-	bool enabletouch, redrawh;
-
-};
-
-
-class  ItemMenu {
-
-	
-public:
-	ItemMenu(Adafruit_ST7735 *Display, bool EnableTouch = false);
-	
-	void init(uint16_t TextColor, uint16_t BackgroundColor,
-		uint16_t HighlightTextColor, uint16_t HighlightColor, 
-		uint16_t ItemRowHeight,uint16_t MaxRow,
-		const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont);
-		
-	int addNI(const char *ItemLabel);
-
-	int addMono(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight );
-
-	int add565(const char *ItemLabel, const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight);
-
-	void draw();
-	
-	void MoveUp();
-
-	void MoveDown();
-
-	int selectRow();
-	
-	void setInitialItem(int ItemID);
-
-	void setTitleColors(uint16_t TitleTextColor, uint16_t TitleFillColor);
-
-	void setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight);
-
-	void setTitleText( char *TitleText,  char *ExitText);
-
-	void setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin);
-
-	void setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, byte BorderRadius, byte BorderThickness);
-
-	void setItemColors( uint16_t DisableTextColor, uint16_t BorderColor);
-
-	void setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin);
-
-	void setItemText(int ItemID, const char *ItemText);
-
-	void setIconMargins(uint16_t LeftMargin, uint16_t TopMargin);
-
-	void SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, uint16_t HighlightTextColor, uint16_t HighlightColor, 
-		uint16_t HighLightBorderColor, uint16_t DisableTextColor, uint16_t TitleTextColor, uint16_t TitleFillColor);
-
-	void disable(int ID);
-
-	void enable(int ID);
-
-	bool getEnableState(int ID);
-
-	int press(int16_t ScreenX, int16_t ScreenY);
-
-	void drawRow(int ID, uint8_t style);
-
-	float value[MAX_OPT];
-
-	int item;
-
-private:
-
-	void drawHeader(bool hl, uint8_t style);
-
-	void drawItems();
-	
-	void drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color);
-
-	void draw565Bitmap(int16_t x, int16_t y, const uint16_t *Bitmap , uint8_t w, uint8_t h);
-
-	Adafruit_ST7735 *d;
-	bool enabletouch;
-	char itemlabel[MAX_OPT][MAX_CHAR_LEN];
-	char ttx[MAX_CHAR_LEN];
-	char etx[MAX_CHAR_LEN];
-	const  GFXfont *itemf;
-	const GFXfont *titlef;
-	uint16_t bkgr, isx, itx, isy, irh, itc, ibc, ihbc, ihtc, isc, imr, irw, ioy, iox;	// item variables
-	uint16_t tbl, tbt, tbw, tbh, ttc, tfc, tox, toy, icox, icoy, di, mm;	// title variables
-	uint16_t ditc, difc, temptColor, bcolor;
-	bool hasIcon = false, moreup = false, moredown = false;
-	int i;
-	int totalID;
-	int MaxRow;
-	int currentID;
-	int cr;
-	byte debounce;
-	int sr, pr;
-	const unsigned char *itemBitmap[MAX_OPT];
-	const uint16_t *item565Bitmap[MAX_OPT];
-	bool rowselected = false;
-	bool drawTitleFlag = true;
-	bool redraw = false;
-	bool enablestate[MAX_OPT];
-	uint8_t bmp_w[MAX_OPT];
-	uint8_t bmp_h[MAX_OPT];
-	byte IconType[MAX_OPT];
-	byte radius, thick;
-
-};
-
-
-#endif
+/*
+  The MIT License (MIT)
+
+  library writen by Kris Kasprzak
+  
+  Permission is hereby granted, free of charge, to any person obtaining a copy of
+  this software and associated documentation files (the "Software"), to deal in
+  the Software without restriction, including without limitation the rights to
+  use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+  the Software, and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+  FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+  COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+  On a personal note, if you develop an application or product using this library 
+  and make millions of dollars, I'm happy for you!
+
+	rev		date			author				change
+	1.0		1/2022			kasprzak			initial code
+	2.0   1/2022      kasprzak      added touch support
+	3.0   3/2022      kasprzak      fixed font issue with MEGA
+ 	4.0   11/2023     kasprzak      fixed ability to set a value with value property (as opposed to using the SetItemValue method
+
+	// Website for generating icons
+	// https://javl.github.io/image2cpp/
+
+
+*/
+
+
+#if MENU_PIPELINE
+// ahead of Arduino.h, whose min and max macros break these on some cores
+#include <atomic>
+#ifndef ARDUINO
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+#endif
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_ST7735.h"
+
+
+#ifndef ADAFRUITST735_MENU_H
+#define ADAFRUITST735_MENU_H
+
+#if ARDUINO >= 100
+	 #include "Arduino.h"
+	 #include "Print.h"
+#else
+	
+#endif
+
+#ifdef __cplusplus
+	
+#endif
+
+// MAX_OPT and MAX_CHAR_LEN set the size of every menu, change them here or with a -D build flag
+// (not a #define in the sketch, the library has to be built with the same values)
+#ifndef MAX_OPT
+#define MAX_OPT 15				// max elements in a menu, increase as needed
+#endif
+#ifndef MENU_ITEM_RAM
+#define MENU_ITEM_RAM 1			// 0 drops the RAM copies of labels, limits and icons, menus are then built with addItems
+#endif
+#ifndef MAX_CHAR_LEN
+#define MAX_CHAR_LEN 30			// max chars in menus, increase as needed
+#endif
+#ifndef MENU_BIND
+#define MENU_BIND 1				// 0 drops EditMenu bind() and refresh() and the pointer per item they keep
+#endif
+#ifndef MENU_FILTER
+#define MENU_FILTER 1			// 0 drops the ItemMenu filter and the match arrays it keeps per item
+#endif
+#define MENU_VALUE_LEN 22		// longest formatted value, sign, 10 digits, point, 9 places
+#define TRIANGLE_H 3.7
+#define TRIANGLE_W 2.5
+#define MENU_C_DKGREY 0x4A49	// used for disable color, method to change
+#define EXIT_TEXT "Exit"		// default text for menu exit text, change here or use a method
+
+#define ICON_NONE 0
+#define ICON_MONO 1
+#define ICON_565  2
+#define ICON_PACKED 3		// palette and run length icon made with extras/packicon.py
+#define ICON_ATLAS  4		// a rectangle of the menu icon atlas, see setIconAtlas
+
+#define BIND_NONE	0
+#define BIND_FLOAT	1
+#define BIND_INT32	2
+#define BIND_UINT8	3
+
+#define ITEM_FLOAT	0			// EditMenu item kinds, a number (or list) kept as float
+#define ITEM_TOGGLE	1			// on / off, flips on select and draws as a check box
+#define ITEM_ENUM	2			// one of a list of texts
+#define ITEM_INT	3			// whole number spinner
+
+#define  BUTTON_PRESSED 1
+#define  BUTTON_NOTPRESSED 0
+
+#define HEADER_ZONE_W 40		// default width of the touch arrow zones at each end of the title bar
+#define TOUCH_SLOP 0			// default pixels a touch may land outside the rows and still count
+
+// zones reported by hitTest
+#define ZONE_NONE		0
+#define ZONE_HEADER		1
+#define ZONE_UPARROW	2
+#define ZONE_DOWNARROW	3
+#define ZONE_ICON		4
+#define ZONE_LABEL		5
+#define ZONE_VALUE		6
+
+// touch events for the gesture handler
+#define TOUCH_DOWN	1
+#define TOUCH_MOVE	2
+#define TOUCH_UP	3
+
+#define IDLE_OFF	1			// idle turns the display off, the panel keeps its picture
+#define IDLE_SLEEP	2			// and puts the panel to sleep as well, lowest current
+
+#define MENU_DAMAGE 8			// rectangles the damage list keeps, more get merged into them
+#define MENU_TILE 16			// default MenuCanvas tile, pixels on a side
+#define MENU_LIST_OPS 160		// default ops in each of the two MenuList buffers, 12 bytes an op
+#define MENU_LIST_FONTS 6		// fonts a MenuList tells apart, title and item font of each menu sharing it plus glyphs
+
+#define DRAG_THRESHOLD 6		// pixels a touch must travel before it is a drag and not a tap
+#define FLICK_DECEL 800			// flick slow down in pixels per second per second
+
+#define  ADAFRUIT_ST7735_MENU_VERSION 4.0
+
+// one menu item that can live in flash, declare a const (PROGMEM on AVR) array of these with
+// the MenuNI, MenuMono and Menu565 builders and hand it to addItems, on AVR the label and list
+// strings have to be PROGMEM too
+// a value or limit of an item, a float for number items and an exact int for the typed ones
+// (so an int past 2^24 is not rounded), MenuNumber(n, true) makes the int
+union MenuNumber {
+	float f;
+	int32_t i;
+	constexpr MenuNumber(float F = 0) : f(F) {}
+	constexpr MenuNumber(int32_t I, bool) : i(I) {}
+};
+
+struct MenuItemDef {
+	const char *label;
+	MenuNumber data, low, high, inc;
+	uint8_t dec;
+	const char * const *list;
+	uint8_t icon;
+	const unsigned char *mono;
+	const uint16_t *color;
+	uint8_t w, h;
+	uint8_t kind;		// ITEM_FLOAT but for the MenuToggle, MenuEnum and MenuInt builders
+};
+
+// one icon of an atlas, where it sits in the sheet
+struct MenuIconRect {
+	uint16_t x, y;
+	uint8_t w, h;
+};
+
+// icons cut from one sheet, a mono, 565 or packed bitmap width pixels wide, so icons used by
+// many items are stored once and a packed sheet shares one palette, items pick an icon with
+// setItemIcon or the MenuIcon builders, icon 1 is rect[0], PROGMEM on AVR
+struct MenuIconAtlas {
+	uint8_t type;
+	const void *sheet;
+	uint16_t width;
+	const MenuIconRect *rect;
+	uint8_t count;
+};
+
+// EditMenu items, same arguments as the add methods
+constexpr MenuItemDef MenuNI(const char *ItemText, float Data = 0, float LowLimit = 0, float HighLimit = 0,
+	float Increment = 0, uint8_t DecimalPlaces = 0, const char * const *ItemMenuText = nullptr) {
+	return MenuItemDef{ItemText, Data, LowLimit, HighLimit, Increment, DecimalPlaces, ItemMenuText,
+		ICON_NONE, nullptr, nullptr, 0, 0, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef MenuMono(const char *ItemText, float Data, float LowLimit, float HighLimit,
+	float Increment, uint8_t DecimalPlaces, const char * const *ItemMenuText,
+	const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemText, Data, LowLimit, HighLimit, Increment, DecimalPlaces, ItemMenuText,
+		ICON_MONO, Bitmap, nullptr, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef Menu565(const char *ItemText, float Data, float LowLimit, float HighLimit,
+	float Increment, uint8_t DecimalPlaces, const char * const *ItemMenuText,
+	const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemText, Data, LowLimit, HighLimit, Increment, DecimalPlaces, ItemMenuText,
+		ICON_565, nullptr, Bitmap, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef MenuPacked(const char *ItemText, float Data, float LowLimit, float HighLimit,
+	float Increment, uint8_t DecimalPlaces, const char * const *ItemMenuText,
+	const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemText, Data, LowLimit, HighLimit, Increment, DecimalPlaces, ItemMenuText,
+		ICON_PACKED, Bitmap, nullptr, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+// the icon is number Icon of the atlas, kept in the width field
+constexpr MenuItemDef MenuIcon(const char *ItemText, float Data, float LowLimit, float HighLimit,
+	float Increment, uint8_t DecimalPlaces, const char * const *ItemMenuText, uint8_t Icon) {
+	return MenuItemDef{ItemText, Data, LowLimit, HighLimit, Increment, DecimalPlaces, ItemMenuText,
+		ICON_ATLAS, nullptr, nullptr, Icon, 0, ITEM_FLOAT};
+}
+
+// typed EditMenu items, same arguments as addToggle, addEnum and addInt
+constexpr MenuItemDef MenuToggle(const char *ItemText, bool Data) {
+	return MenuItemDef{ItemText, MenuNumber(Data, true), MenuNumber(0, true), MenuNumber(1, true), MenuNumber(1, true), 0, nullptr,
+		ICON_NONE, nullptr, nullptr, 0, 0, ITEM_TOGGLE};
+}
+
+constexpr MenuItemDef MenuEnum(const char *ItemText, uint8_t Data, const char * const *ItemMenuText, uint8_t Count) {
+	return MenuItemDef{ItemText, MenuNumber(Data, true), MenuNumber(0, true), MenuNumber(Count, true), MenuNumber(1, true), 0,
+		ItemMenuText, ICON_NONE, nullptr, nullptr, 0, 0, ITEM_ENUM};
+}
+
+constexpr MenuItemDef MenuInt(const char *ItemText, int32_t Data, int32_t LowLimit, int32_t HighLimit, int32_t Increment = 1) {
+	return MenuItemDef{ItemText, MenuNumber(Data, true), MenuNumber(LowLimit, true), MenuNumber(HighLimit, true),
+		MenuNumber(Increment, true), 0, nullptr, ICON_NONE, nullptr, nullptr, 0, 0, ITEM_INT};
+}
+
+// ItemMenu items
+constexpr MenuItemDef MenuMono(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemLabel, 0, 0, 0, 0, 0, nullptr, ICON_MONO, Bitmap, nullptr, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef Menu565(const char *ItemLabel, const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemLabel, 0, 0, 0, 0, 0, nullptr, ICON_565, nullptr, Bitmap, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef MenuPacked(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight) {
+	return MenuItemDef{ItemLabel, 0, 0, 0, 0, 0, nullptr, ICON_PACKED, Bitmap, nullptr, BitmapWidth, BitmapHeight, ITEM_FLOAT};
+}
+
+constexpr MenuItemDef MenuIcon(const char *ItemLabel, uint8_t Icon) {
+	return MenuItemDef{ItemLabel, 0, 0, 0, 0, 0, nullptr, ICON_ATLAS, nullptr, nullptr, Icon, 0, ITEM_FLOAT};
+}
+
+// glyphs past the item font for labels and values, glyph n of font draws code point code[n]
+// with code sorted ascending, the font runs from 0x80 so it holds up to MENU_GLYPHS glyphs (a
+// glyph is drawn as the byte first + n, setGlyphs turns down a font that goes past 0xFF), make
+// it with fontconvert from the same face and size as the item font, PROGMEM on AVR
+#define MENU_GLYPHS 128		// 0x80 to 0xFF
+
+struct MenuGlyphs {
+	const uint16_t *code;
+	GFXfont font;
+};
+
+// result of a touch hit test, row is the screen row (1 to MaxRow) and id the item (0 is the title bar)
+struct MenuHit {
+	int row;
+	int id;
+	uint8_t zone;
+};
+
+// set MENU_PROFILE to 1 (here or with a -D build flag) to count calls, time and pixels sent by each drawing
+// function, when 0 the probes compile to nothing
+#ifndef MENU_PROFILE
+#define MENU_PROFILE 0
+#endif
+
+#define MENU_PROFILE_FRAMES 16	// how many of the most recent top level calls to keep
+
+// functions the profiler keeps track of
+#define PROF_HEADER		0
+#define PROF_ITEMS		1
+#define PROF_ROW		2
+#define PROF_VALUE		3
+#define PROF_INCREMENT	4
+#define PROF_MONO		5
+#define PROF_565		6
+#define PROF_SCROLL		7
+#define PROF_TICK		8
+#define PROF_PRESS		9
+#define PROF_PACKED		10
+#define PROF_COUNT		11
+
+#if MENU_PROFILE
+
+struct MenuProfileFrame {
+	uint8_t id;		// the top level function
+	uint32_t us;
+	uint32_t pixels;
+};
+
+// time is counted in every function on the call stack, pixels only in the innermost one
+// text is drawn by the GFX library and its pixels are not counted
+class MenuProfiler {
+
+public:
+
+	static void pixels(uint32_t Count);
+
+	static void dump(Print &Out);
+
+	static void reset();
+
+	static uint32_t calls[PROF_COUNT];
+	static uint32_t us[PROF_COUNT];
+	static uint32_t pix[PROF_COUNT];
+	static MenuProfileFrame frame[MENU_PROFILE_FRAMES];
+	static uint8_t frames;	// next slot in frame
+
+private:
+
+	friend class MenuProbe;
+
+	static uint8_t current, depth;
+	static uint32_t framepix;
+
+};
+
+class MenuProbe {
+
+public:
+
+	MenuProbe(uint8_t ID);
+
+	~MenuProbe();
+
+private:
+
+	uint8_t id, parent;
+	uint32_t t0;
+
+};
+
+#define MENU_PROBE(id)		MenuProbe probe(id)
+#define MENU_PIXELS(n)		MenuProfiler::pixels(n)
+
+#else
+
+#define MENU_PROBE(id)
+#define MENU_PIXELS(n)
+
+#endif
+
+// drag and flick tracking for touch menus, positions are pixels from the top of the item list,
+// a drag stays between Low and Limit, both at Position holds the list still
+class MenuScroll {
+
+public:
+
+	void press(int16_t ScreenY, int32_t Position, int32_t Limit, int32_t Low = 0);
+
+	bool move(int16_t ScreenY);
+
+	bool release();
+
+	bool step();
+
+	int32_t pos = 0;
+	bool dragging = false;
+	bool flinging = false;
+	uint8_t threshold = DRAG_THRESHOLD;
+	uint16_t decel = FLICK_DECEL;
+
+private:
+
+	// a move before any press stays put at the top
+	int16_t y0 = 0, ly = 0;
+	int32_t p0 = 0, limit = 0, low = 0;
+	uint32_t lt = 0;
+	float fpos = 0, vel = 0;	// vel in pixels per ms
+
+};
+
+// paces redraws to a frame rate and keeps count of how that went
+class MenuFrames {
+
+public:
+
+	void setRate(uint8_t FramesPerSecond);
+
+	void request();
+
+	bool due();
+
+	void drawn();
+
+	void reset();
+
+	uint32_t period = 0;	// us between frames, 0 draws on every call
+	bool pending = false;
+	uint32_t requests = 0;	// redraws asked for
+	uint32_t frames = 0;	// frames actually drawn
+	uint32_t dropped = 0;	// requests merged into another frame
+	uint32_t late = 0;		// frames drawn more than a period after they were asked for
+	uint32_t latency = 0;	// total us from request to draw, divide by frames for the average
+	uint32_t maxlatency = 0;
+
+private:
+
+	uint32_t last = 0, first = 0;
+
+};
+
+// how long going idle and waking took, wake includes the redraw when one was needed
+struct MenuIdleStats {
+	uint32_t entries = 0;	// times the menu went idle
+	uint32_t enterus = 0;	// us for the last idle entry
+	uint32_t wakeus = 0;	// us for the last wake
+	uint32_t maxwakeus = 0;
+};
+
+// a screen rectangle, the viewport of a menu and the damage it reports
+struct MenuRect {
+	int16_t x = 0, y = 0, w = 0, h = 0;
+};
+
+// set MENU_PIPELINE to 1 to build MenuPipeline, a MenuCanvas then hands what flush sends to a
+// renderer task on the other core (ESP32) or a thread (PC), needs <atomic>, so not on AVR
+#ifndef MENU_PIPELINE
+#define MENU_PIPELINE 0
+#endif
+
+#define MENU_QUEUE 4			// windows the pipeline queue holds
+#define MENU_QUEUE_PIXELS 1024	// pixels in one queued window, at least the display width
+
+#if MENU_PIPELINE
+
+// runs the renderer, derive from this for another RTOS or thread library
+class MenuThread {
+
+public:
+
+	virtual bool start(void (*Run)(void *Arg), void *Arg) = 0;
+
+	virtual void wait() = 0;		// renderer, sleeps until signal() or a few ms went by
+
+	virtual void signal() = 0;		// wakes the renderer
+
+	virtual void yield() = 0;		// producer, the queue is full or being drained
+
+	virtual void join() = 0;		// waits for Run to return
+
+};
+
+#if defined(ESP32)
+
+// a FreeRTOS task pinned to Core, the Arduino loop runs on core 1
+class MenuRTOSThread : public MenuThread {
+
+public:
+
+	MenuRTOSThread(uint8_t Core = 0, uint8_t Priority = 1, uint16_t Stack = 2048);
+
+	bool start(void (*Run)(void *Arg), void *Arg);
+
+	void wait();
+
+	void signal();
+
+	void yield();
+
+	void join();
+
+private:
+
+	static void task(void *Self);
+
+	void (*run)(void *Arg);
+	void *arg;
+	TaskHandle_t handle = nullptr;
+	volatile bool done = true;
+	uint8_t core, priority;
+	uint16_t stack;
+
+};
+
+#endif
+
+#ifndef ARDUINO
+
+// a std::thread, for running the pipeline on a PC
+class MenuStdThread : public MenuThread {
+
+public:
+
+	bool start(void (*Run)(void *Arg), void *Arg);
+
+	void wait();
+
+	void signal();
+
+	void yield();
+
+	void join();
+
+private:
+
+	std::thread t;
+	std::mutex m;
+	std::condition_variable c;
+	bool woken = false;
+
+};
+
+#endif
+
+// a single producer, single consumer queue of address windows and their pixels, the pixels are
+// copied in so the canvas can be drawn on again while the renderer sends, push waits when the
+// queue is full, only the renderer talks to the panel once begin is called
+class MenuPipeline {
+
+public:
+
+	MenuPipeline(Adafruit_ST7735 *Display, MenuThread *Thread);
+
+	~MenuPipeline();
+
+	bool begin();
+
+	bool push(const uint16_t *Pixels, int16_t Stride, int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	void drain();
+
+	uint32_t pushed = 0;	// windows queued, a window taller than a slot is several
+	uint32_t stalls = 0;	// pushes that found the queue full
+	uint32_t stallus = 0;	// us the producer spent waiting for room
+
+private:
+
+	static void run(void *Arg);
+
+	struct Slot {
+		int16_t x, y, w, h;
+		uint16_t px[MENU_QUEUE_PIXELS];
+	};
+
+	Adafruit_ST7735 *d;
+	MenuThread *th;
+	Slot q[MENU_QUEUE];
+	std::atomic<uint32_t> head, tail;	// slots pushed and sent, free running
+	std::atomic<bool> running;
+
+};
+
+#endif
+
+// a full screen 565 frame in RAM, 40k for a 160 x 128 panel so it is for the ESP32 and the like,
+// menus given it with setCanvas draw here and flush sends the tiles that changed to the panel,
+// several menus and your own GFX drawing can share one canvas, a tile is compared to what was
+// last sent by a 32 bit checksum, build it after setRotation as it takes the display size then
+class MenuCanvas : public GFXcanvas16 {
+
+public:
+
+	MenuCanvas(Adafruit_ST7735 *Display, uint8_t Tile = MENU_TILE);
+
+	~MenuCanvas();
+
+	void drawPixel(int16_t x, int16_t y, uint16_t color);
+
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+	void fillScreen(uint16_t color);
+
+	uint16_t flush();
+
+	void invalidate();
+
+	void drain();
+
+#if MENU_PIPELINE
+	void setPipeline(MenuPipeline *Pipeline);
+#endif
+
+	uint16_t tiles = 0;		// tiles in the frame
+	uint16_t drawn = 0;		// tiles drawn on before the last flush
+	uint16_t dirty = 0;		// tiles the last flush sent, drawn tiles that came out the same are not
+	uint32_t flushes = 0;
+	uint32_t sent = 0;		// tiles sent by all flushes
+
+private:
+
+	void mark(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	uint32_t checksum(int16_t X, int16_t Y);
+
+	Adafruit_ST7735 *d;
+	uint8_t ts, cols, rows;
+	uint8_t *marks;			// a bit for each tile drawn on since the last flush
+	uint32_t *sum;			// each tile as last sent
+	bool all = true;		// send every tile on the next flush
+#if MENU_PIPELINE
+	MenuPipeline *pipe = nullptr;
+#endif
+
+};
+
+// one recorded drawing call, a filled rectangle, a character or an icon, which takes three
+struct MenuOp {
+	uint8_t op, a;
+	int16_t x, y, w, h;
+	uint16_t c;
+};
+
+// a display list for boards with no RAM for a MenuCanvas, menus given it with setList record
+// their draw() in it instead of drawing, it is then compared with the list of the last draw and
+// only the ops that changed, or that land where something changed, go out to the screen, menus
+// drawing on one screen share one list, a draw with more than MaxOps ops or more fonts than
+// MENU_LIST_FONTS goes out whole, call invalidate after drawing on the screen yourself
+class MenuList : public Adafruit_GFX {
+
+public:
+
+	MenuList(Adafruit_ST7735 *Display, uint16_t MaxOps = MENU_LIST_OPS, MenuCanvas *Canvas = nullptr);
+
+	~MenuList();
+
+	void drawPixel(int16_t x, int16_t y, uint16_t color);
+
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+	size_t write(uint8_t c);
+
+	using Print::write;
+
+	void icon(int16_t X, int16_t Y, uint8_t Type, const void *Bits, uint16_t SW, uint16_t SX, uint16_t SY,
+		uint8_t W, uint8_t H, uint16_t Color);
+
+	void begin();
+
+	void end();
+
+	void invalidate();
+
+	uint16_t ops = 0;		// ops in the last draw
+	uint16_t played = 0;	// ops the last draw sent
+	uint32_t draws = 0;
+	uint32_t overflows = 0;	// draws that went out whole as they did not fit
+
+private:
+
+	void add(const MenuOp *Op, uint8_t Count);
+
+	void rect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color);
+
+	void play(const MenuOp *Op);
+
+	MenuRect box(const MenuOp *List, uint16_t K);
+
+	Adafruit_ST7735 *d;
+	MenuCanvas *cv;
+	Adafruit_GFX *out;
+	MenuOp *cur, *old;		// the draw being recorded and the one on the screen
+	uint16_t cap, n = 0, m = 0;
+	const GFXfont *fonts[MENU_LIST_FONTS];
+	uint8_t nf = 0;
+	bool valid = false;		// old is what the screen shows
+	bool through = false;	// out of room, ops are drawn as they come
+
+};
+
+// set MENU_EEPROM to 1 to build MenuEEPROMStore, this pulls in the EEPROM library
+#ifndef MENU_EEPROM
+#define MENU_EEPROM 0
+#endif
+
+#define JOURNAL_RECORD 8		// bytes per saved value
+#define JOURNAL_INT 0x80		// set in a record's ID byte when it holds an int32, items up to 127
+#define JOURNAL_VERSION 2		// record format, held by the marker record
+
+// byte storage for saved menu values, derive from this to keep values somewhere else
+class MenuStore {
+
+public:
+
+	virtual uint8_t read(uint32_t Address) = 0;
+
+	virtual void write(uint32_t Address, uint8_t Data) = 0;
+
+	virtual void read(uint32_t Address, uint8_t *Data, uint16_t Count);
+
+	virtual void write(uint32_t Address, const uint8_t *Data, uint16_t Count);
+
+	virtual void commit() {}
+
+};
+
+#if MENU_EEPROM
+
+// EEPROM on AVR and Teensy, the emulated EEPROM in flash on ESP32 (call EEPROM.begin(size) first)
+class MenuEEPROMStore : public MenuStore {
+
+public:
+
+	using MenuStore::read;
+	using MenuStore::write;
+
+	uint8_t read(uint32_t Address);
+
+	void write(uint32_t Address, uint8_t Data);
+
+	void commit();
+
+};
+
+#endif
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+
+// a file standing in for EEPROM when the menus are built on a PC
+class MenuFileStore : public MenuStore {
+
+public:
+
+	MenuFileStore(const char *Path, uint32_t Size);
+
+	~MenuFileStore();
+
+	using MenuStore::read;
+	using MenuStore::write;
+
+	uint8_t read(uint32_t Address);
+
+	void write(uint32_t Address, uint8_t Data);
+
+	void commit();
+
+private:
+
+	FILE *f;
+
+};
+
+#endif
+
+class  EditMenu {
+		
+public:
+
+	EditMenu(Adafruit_ST7735 *Display,bool EnableTouch = false);
+
+	~EditMenu();
+
+	// a menu owns its scroll strip, so menus are not copied
+	EditMenu(const EditMenu &) = delete;
+
+	EditMenu &operator=(const EditMenu &) = delete;
+
+	void init(uint16_t TextColor, uint16_t BackgroundColor, 
+		uint16_t HighlightTextColor, uint16_t HighlightColor,
+		uint16_t SelectedTextColor, uint16_t SelectedColor,
+		uint16_t MenuColumn, uint16_t ItemRowHeight,uint16_t MaxRow,
+		const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont);
+
+#if MENU_ITEM_RAM
+	int addNI(const char *ItemText, float Data, float LowLimit, float HighLimit, 
+		float Increment, byte DecimalPlaces = 0, const char **ItemMenuText = NULL);
+
+	int addMono(const char *ItemText, float Data, float LowLimit, float HighLimit, 
+		float Increment, byte DecimalPlaces = 0,const char **ItemMenuText = NULL, 
+		const unsigned char *Bitmap = nullptr, uint8_t BitmapWidth = 0, uint8_t BitmapHeight = 0);
+
+	int add565(const char *ItemText, float Data, float LowLimit, float HighLimit, 
+		float Increment, byte DecimalPlaces = 0, const char **ItemMenuText = NULL, 
+		const uint16_t *Bitmap = nullptr, uint8_t BitmapWidth = 0, uint8_t BitmapHeight = 0);
+
+	int addPacked(const char *ItemText, float Data, float LowLimit, float HighLimit, 
+		float Increment, byte DecimalPlaces = 0, const char **ItemMenuText = NULL, 
+		const unsigned char *Bitmap = nullptr, uint8_t BitmapWidth = 0, uint8_t BitmapHeight = 0);
+
+	int addToggle(const char *ItemText, bool Data);
+
+	int addEnum(const char *ItemText, uint8_t Data, const char **ItemMenuText, uint8_t Count);
+
+	int addInt(const char *ItemText, int32_t Data, int32_t LowLimit, int32_t HighLimit, int32_t Increment = 1);
+#endif
+
+	int addItems(const MenuItemDef *Items, uint8_t Count);
+	
+	int selectRow();
+
+	void draw();
+
+	void MoveUp();
+
+	void MoveDown();
+	
+	void setInitialItem(int ItemID);
+
+	void setTitleColors(uint16_t TitleTextColor, uint16_t TitleFillColor);
+
+	void setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight);
+
+	void setTitleText( char *TitleText,  char *ExitText);
+
+	void setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin);
+
+	void setIncrementDelay(uint16_t Delay);
+	
+	void setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, uint16_t BorderRadius, uint16_t BorderThickness);
+
+	void setItemColors( uint16_t DisableTextColor, uint16_t BorderColor, uint16_t EditModeBorderColor = 0);
+
+	void setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin);
+
+	void setItemText(int ItemID, const char *ItemText);
+
+	void setIconMargins(uint16_t LeftMargin, uint16_t TopMargin);
+
+	void SetItemValue(int ItemID, float ItemValue);
+
+	int32_t getInt(int ItemID);
+
+	void setInt(int ItemID, int32_t ItemValue);
+
+#if MENU_BIND
+	void bind(int ItemID, float *Data);
+
+	void bind(int ItemID, int32_t *Data);
+
+	void bind(int ItemID, uint8_t *Data);
+
+	int refresh();
+#endif
+
+	void setValueWidth(uint16_t Width);
+
+	void setHighlightSlide(uint8_t Steps, uint16_t Millis);
+
+	void setGlyphs(const MenuGlyphs *Glyphs);
+
+	void setIconAtlas(const MenuIconAtlas *Atlas);
+
+	void setItemIcon(int ItemID, uint8_t Icon);
+
+	void SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, 
+							uint16_t HighlightTextColor, uint16_t HighlightColor, uint16_t HighlightBorderColor,
+							uint16_t SelectedTextColor, uint16_t SelectedColor, uint16_t SelectBorderColor,
+							uint16_t DisableTextColor ,	uint16_t TitleTextColor, uint16_t TitleFillColor);
+
+	void disable(int ID);
+
+	void enable(int ID);
+
+	bool getEnableState(int ID);
+	
+	int press(int16_t ScreenX, int16_t ScreenY);
+
+	bool hitTest(int16_t ScreenX, int16_t ScreenY, MenuHit &Hit);
+
+	void setTouchSlop(uint8_t Slop);
+
+	void setHeaderZones(uint16_t UpArrowWidth, uint16_t DownArrowWidth);
+
+	int touch(int16_t ScreenX, int16_t ScreenY, uint8_t Event);
+
+	bool updateScroll();
+
+	void setScrollPhysics(uint8_t DragThreshold, uint16_t Deceleration);
+
+	void setFrameRate(uint8_t FramesPerSecond);
+
+	bool tick();
+
+	const MenuFrames &getFrameStats();
+
+	void setIdle(uint32_t Timeout, uint8_t Mode = IDLE_SLEEP, void (*Hook)(bool Idle) = nullptr);
+
+	bool wake();
+
+	bool isIdle();
+
+	const MenuIdleStats &getIdleStats();
+
+	static void memoryReport(Print &Out);
+
+	static char *formatValue(char *Buf, float Value, uint8_t Places);
+
+	void setViewport(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	uint8_t getDamage(const MenuRect *&Rects);
+
+	void clearDamage();
+
+	void setCanvas(MenuCanvas *Canvas);
+
+	void setList(MenuList *List);
+
+	void setDigitEdit(bool Enable);
+
+	void setKeypad(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	void setStore(MenuStore *Store, uint32_t Address, uint32_t Size, uint16_t IdleSave = 0);
+
+	int restore();
+
+	int save();
+
+	void drawRow(int ID);
+		
+	float value[MAX_OPT];
+
+	int item;
+
+private:
+
+	void drawHeader(bool hl, uint8_t Style);
+
+	void dropStrip();
+
+	void up();
+
+	void down();
+
+	void incrementUp();
+	
+	void incrementDown();
+
+	void update();
+
+	void drawItems();
+
+	void scrollItems();
+
+	void paintItems();
+
+	void paintRow(int ID);
+
+	void paintValue();
+
+	void clearPending();
+
+	bool readRecord(uint8_t Region, uint16_t Slot, uint16_t &Epoch, uint8_t &ID, uint32_t &Value);
+
+	void writeRecord(uint8_t ID, uint32_t Value);
+
+	uint32_t itemBits(int ID);
+
+	void writeItem(int ID);
+
+	bool findJournal();
+
+	void drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color);
+
+	void draw565Bitmap(int16_t x, int16_t y, const uint16_t *bitmap, uint8_t w, uint8_t h);
+
+	void drawPackedBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h);
+
+	void drawScroll();
+
+	void settleScroll();
+
+	void slideBar(int From, int To);
+
+	void paintBand(int16_t Y0, int16_t Y1, bool hl);
+
+	void printLabel(Adafruit_GFX *Out, int ID);
+
+	uint8_t iconType(int ID);
+
+	const unsigned char *monoBitmap(int ID);
+
+	const uint16_t *colorBitmap(int ID);
+
+	uint8_t iconW(int ID);
+
+	uint8_t iconH(int ID);
+
+	uint8_t atlasIcon(int ID);
+
+	uint8_t iconSheet(int ID, const void *&Bits, uint16_t &Width, uint16_t &X, uint16_t &Y);
+
+	void goIdle();
+
+	void drawAtlasIcon(int16_t x, int16_t y, int ID, uint16_t color);
+
+	void printTitle(const char *Text);
+
+	void touched(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	MenuNumber limit(int ID, uint8_t Which);
+
+	float lowLimit(int ID);
+
+	float highLimit(int ID);
+
+	float increment(int ID);
+
+	uint8_t places(int ID);
+
+	bool hasList(int ID);
+
+	uint8_t itemKind(int ID);
+
+	int32_t fitInt(int ID, int32_t Value);
+
+	void syncInt(int ID);
+
+	void stepInt(int ID, int8_t Dir);
+
+	void flip(int ID);
+
+	void drawToggle(Adafruit_GFX *Out, int ID, uint16_t Color);
+
+	void paintToggle(int ID, uint16_t Fore, uint16_t Back);
+
+	char *valueText(char *Buf, int ID);
+
+	int16_t valueX(const char *Text);
+
+	void printValue(Adafruit_GFX *Out, int ID, uint16_t Color);
+
+	void paintCell(const char *Old, const char *Text, int16_t Y, uint16_t Back);
+
+	uint8_t digits(int ID);
+
+	int8_t digitTop(int ID);
+
+	bool digitEdit(int ID);
+
+	uint32_t digitValue(int ID);
+
+	bool digitNegative(int ID);
+
+	void setDigits(int ID, uint32_t Scaled, bool Negative);
+
+	void editDigit(int8_t Digit, int8_t Step);
+
+	void showValue();
+
+	void endDigits();
+
+	void paintDigit(const char *Text, int16_t Y);
+
+	void openKeypad();
+
+	void closeKeypad();
+
+	void paintKey(int8_t Key, bool Pressed);
+
+	void pressKey(int8_t Key);
+
+#if MENU_BIND
+	bool readBound(int ID, float &Value, int32_t &Int);
+#endif
+
+	void writeBound(int ID);
+
+	Adafruit_GFX *d;			// where drawing goes, the panel or a MenuCanvas
+	Adafruit_ST7735 *tft;
+	MenuCanvas *cv = nullptr;
+	MenuList *ls = nullptr;
+#if MENU_ITEM_RAM
+	char itemlabel[MAX_OPT][MAX_CHAR_LEN];
+#endif
+	const MenuItemDef *defs = nullptr;	// items from addItems
+	const char *rlabel[MAX_OPT];		// setItemText labels for addItems menus
+	char ttx[MAX_CHAR_LEN];
+	char etx[MAX_CHAR_LEN]; 
+	const GFXfont *itemf;
+	const GFXfont *titlef;
+	uint16_t itc, ibc, ihtc, ihbc, istc, isbc;	// item variables
+	uint16_t tbl, tbt, tbw, tbh, ttc, tfc, tox, toy;	// title variables
+	// margins
+	uint16_t imr, isx, itx, isy, irh, irw, ioy, iox, mm,icox, icoy;
+	int i;
+	int totalID;
+	int MaxRow;
+	int currentID;
+	int cr;
+	byte debounce;
+	int sr, pr;
+	bool moreup = false, moredown = false;
+	uint16_t col;
+#if MENU_ITEM_RAM
+	MenuNumber low[MAX_OPT];
+	MenuNumber high[MAX_OPT];
+	MenuNumber inc[MAX_OPT];
+	byte dec[MAX_OPT];
+	char **itemtext[MAX_OPT];
+	bool haslist[MAX_OPT];
+	uint8_t kind[MAX_OPT];
+#endif
+	bool rowselected = false;
+	bool enablestate[MAX_OPT];
+	bool drawTitleFlag = true;
+	bool redraw = false;
+	uint16_t ditc = 0;
+	uint16_t temptColor = 0, bcolor, sbcolor;
+#if MENU_ITEM_RAM
+	const unsigned char	*itemBitmap[MAX_OPT];
+	const uint16_t *item565Bitmap[MAX_OPT];
+	uint8_t bmp_w[MAX_OPT];
+	uint8_t bmp_h[MAX_OPT];
+	byte IconType[MAX_OPT];
+#endif
+	uint16_t  radius = 0;
+	uint16_t thick = 0;
+	uint16_t incdelay = 50;
+	bool enabletouch, redrawh = false;
+	uint16_t huw = HEADER_ZONE_W, hdw = HEADER_ZONE_W;	// header touch zones
+	uint8_t slop = TOUCH_SLOP;
+	MenuScroll scroll;
+	GFXcanvas1 *strip = nullptr;	// one row of text for drawing rows part way off the list
+	int16_t tx, ty;
+	bool caught = false;
+	MenuFrames fr;
+	bool pendnav = false, pendredraw = false, pendscroll = false;
+	bool pendrow[MAX_OPT];
+	int pendval = -1;
+	// value journal, two regions of jslots records that take turns
+	MenuStore *store = nullptr;
+	uint32_t jbase;
+	uint16_t jslots, jslot, jepoch;
+	uint8_t jregion, jver;
+	bool jfound = false;	// the newest good region is known, jregion, jepoch and jver are it
+	bool jvalid = false;	// and it holds every item, so edits can be appended
+	uint32_t saved[MAX_OPT];		// the bits each item was last journaled as
+	uint16_t idlesave;
+	uint32_t lastedit;
+	bool unsaved = false;
+	// value cell, vtx is the text on screen for item vid while it is edited
+	uint16_t vcw = 0;
+	char vtx[MAX_CHAR_LEN];
+	int vid = 0;
+	uint8_t slides = 0;		// highlight slide steps, 0 jumps
+	uint16_t slidems;
+	const MenuGlyphs *glyphs = nullptr;	// UTF-8 glyphs past the item font
+	const MenuIconAtlas *atlas = nullptr;
+	uint8_t aicon[MAX_OPT];		// atlas icon of each item, 0 uses the item's own bitmap
+	// idle, drawing is held off while idle and stale says the panel needs a redraw on wake
+	uint32_t idlems = 0, lastinput = 0;
+	uint8_t idlemode = IDLE_SLEEP;
+	bool idle = false, stale = false, waking = false;
+	void (*idlehook)(bool Idle) = nullptr;
+	MenuIdleStats ist;
+	// viewport, w of 0 is the whole screen, and the rectangles drawn since clearDamage
+	MenuRect view;
+	MenuRect dmg[MENU_DAMAGE];
+	uint8_t ndmg = 0;
+#if MENU_BIND
+	// items bound to sketch variables
+	void *bound[MAX_OPT];
+	uint8_t boundtype[MAX_OPT];
+#endif
+	// digit edit, dp is the power of ten under the cursor (digitTop is the sign when the low limit
+	// is below 0), dcx/dcw the cursor on screen, kp the keypad on screen and kr where setKeypad put it
+	bool dedit = false;
+	int8_t dp = 0, kkey = -1;
+	int16_t dcx = 0, dcw = 0;
+	MenuRect kr, kp;
+	// toggles, enums and ints work from ival, value[] follows it for the sketch, binds and the store
+	int32_t ival[MAX_OPT];
+
+};
+
+
+class  ItemMenu {
+
+	
+public:
+	ItemMenu(Adafruit_ST7735 *Display, bool EnableTouch = false);
+
+	~ItemMenu();
+
+	// a menu owns its scroll strip, so menus are not copied
+	ItemMenu(const ItemMenu &) = delete;
+
+	ItemMenu &operator=(const ItemMenu &) = delete;
+	
+	void init(uint16_t TextColor, uint16_t BackgroundColor,
+		uint16_t HighlightTextColor, uint16_t HighlightColor, 
+		uint16_t ItemRowHeight,uint16_t MaxRow,
+		const char *TitleText, const GFXfont &ItemFont, const GFXfont &TitleFont);
+		
+#if MENU_ITEM_RAM
+	int addNI(const char *ItemLabel);
+
+	int addMono(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight );
+
+	int add565(const char *ItemLabel, const uint16_t *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight);
+
+	int addPacked(const char *ItemLabel, const unsigned char *Bitmap, uint8_t BitmapWidth, uint8_t BitmapHeight);
+#endif
+
+	int addItems(const MenuItemDef *Items, uint8_t Count);
+
+	void draw();
+	
+	void MoveUp();
+
+	void MoveDown();
+
+	void MoveLeft();
+
+	void MoveRight();
+
+	int selectRow();
+	
+	void setInitialItem(int ItemID);
+
+	void setGrid(uint8_t Columns, uint8_t Rows, uint16_t CellHeight);
+
+	void setHighlightSlide(uint8_t Steps, uint16_t Millis);
+
+	void setGlyphs(const MenuGlyphs *Glyphs);
+
+	void setIconAtlas(const MenuIconAtlas *Atlas);
+
+	void setItemIcon(int ItemID, uint8_t Icon);
+
+	void setTitleColors(uint16_t TitleTextColor, uint16_t TitleFillColor);
+
+	void setTitleBarSize(uint16_t TitleTop, uint16_t TitleLeft, uint16_t TitleWith, uint16_t TitleHeight);
+
+	void setTitleText( char *TitleText,  char *ExitText);
+
+	void setTitleTextMargins(uint16_t LeftMargin, uint16_t TopMargin);
+
+	void setMenuBarMargins(uint16_t LeftMargin, uint16_t Width, byte BorderRadius, byte BorderThickness);
+
+	void setItemColors( uint16_t DisableTextColor, uint16_t BorderColor);
+
+	void setItemTextMargins(uint16_t LeftMargin, uint16_t TopMargin, uint16_t MenuMargin);
+
+	void setItemText(int ItemID, const char *ItemText);
+
+	void setIconMargins(uint16_t LeftMargin, uint16_t TopMargin);
+
+	void SetAllColors(uint16_t TextColor, uint16_t BackgroundColor, uint16_t HighlightTextColor, uint16_t HighlightColor, 
+		uint16_t HighLightBorderColor, uint16_t DisableTextColor, uint16_t TitleTextColor, uint16_t TitleFillColor);
+
+	void disable(int ID);
+
+	void enable(int ID);
+
+	bool getEnableState(int ID);
+
+	int press(int16_t ScreenX, int16_t ScreenY);
+
+	bool hitTest(int16_t ScreenX, int16_t ScreenY, MenuHit &Hit);
+
+	void setTouchSlop(uint8_t Slop);
+
+	void setHeaderZones(uint16_t UpArrowWidth, uint16_t DownArrowWidth);
+
+	int touch(int16_t ScreenX, int16_t ScreenY, uint8_t Event);
+
+	bool updateScroll();
+
+	void setScrollPhysics(uint8_t DragThreshold, uint16_t Deceleration);
+
+	void setFrameRate(uint8_t FramesPerSecond);
+
+	bool tick();
+
+	const MenuFrames &getFrameStats();
+
+	void setIdle(uint32_t Timeout, uint8_t Mode = IDLE_SLEEP, void (*Hook)(bool Idle) = nullptr);
+
+	bool wake();
+
+	bool isIdle();
+
+	const MenuIdleStats &getIdleStats();
+
+	static void memoryReport(Print &Out);
+
+	void setViewport(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	uint8_t getDamage(const MenuRect *&Rects);
+
+	void clearDamage();
+
+	void setCanvas(MenuCanvas *Canvas);
+
+	void setList(MenuList *List);
+
+	void drawRow(int ID, uint8_t style);
+
+#if MENU_FILTER
+	int setFilter(const char *Text, bool Substring = false);
+
+	int filterKey(char Key);
+
+	const char *getFilter();
+#endif
+
+	float value[MAX_OPT];
+
+	int item;
+
+private:
+
+	void drawHeader(bool hl, uint8_t style);
+
+	void dropStrip();
+
+	void update();
+
+	void drawItems();
+
+	void scrollItems();
+
+	void paintItems();
+
+	void paintRow(int ID, uint8_t style);
+
+	void paintLine(int Row);
+
+	void clearPending();
+	
+	void drawMonoBitmap(int16_t x, int16_t y, const unsigned char *bitmap, uint8_t w, uint8_t h, uint16_t color);
+
+	void draw565Bitmap(int16_t x, int16_t y, const uint16_t *Bitmap , uint8_t w, uint8_t h);
+
+	void drawPackedBitmap(int16_t x, int16_t y, const unsigned char *Bitmap, uint8_t w, uint8_t h);
+
+	void drawScroll();
+
+	void settleScroll();
+
+	void slideBar(int From, int To);
+
+	void paintBand(int16_t Y0, int16_t Y1, bool hl);
+
+	int gridNext(int ID, int Step);
+
+	bool gridAny();
+
+	void gridGo(int Step);
+
+	void gridSelect(int ID);
+
+	void gridPage(int Dir);
+
+	void paintTiles();
+
+	void paintTile(int ID, uint8_t style);
+
+	void printLabel(Adafruit_GFX *Out, int ID, int16_t Right = 0);
+
+	uint8_t iconType(int ID);
+
+	const unsigned char *monoBitmap(int ID);
+
+	const uint16_t *colorBitmap(int ID);
+
+	uint8_t iconW(int ID);
+
+	uint8_t iconH(int ID);
+
+	uint8_t atlasIcon(int ID);
+
+	uint8_t atlasOf(int ID);
+
+	uint8_t iconSheet(int ID, const void *&Bits, uint16_t &Width, uint16_t &X, uint16_t &Y);
+
+	void goIdle();
+
+	void drawAtlasIcon(int16_t x, int16_t y, int ID, uint16_t color);
+
+	void printTitle(const char *Text);
+
+	void touched(int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	int at(int Pos);
+
+	int place(int ID);
+
+#if MENU_FILTER
+	char labelChar(int ID, uint8_t K);
+
+	bool labelMatch(int ID);
+#endif
+
+	void listNew();
+
+	const char *titleText();
+
+	Adafruit_GFX *d;			// where drawing goes, the panel or a MenuCanvas
+	Adafruit_ST7735 *tft;
+	MenuCanvas *cv = nullptr;
+	MenuList *ls = nullptr;
+	bool enabletouch;
+#if MENU_ITEM_RAM
+	char itemlabel[MAX_OPT][MAX_CHAR_LEN];
+#endif
+	const MenuItemDef *defs = nullptr;	// items from addItems
+	const char *rlabel[MAX_OPT];		// setItemText labels for addItems menus
+	char ttx[MAX_CHAR_LEN];
+	char etx[MAX_CHAR_LEN];
+	const  GFXfont *itemf;
+	const GFXfont *titlef;
+	uint16_t bkgr, isx, itx, isy, irh, itc, ibc, ihbc, ihtc, isc, imr, irw, ioy, iox;	// item variables
+	uint16_t tbl, tbt, tbw, tbh, ttc, tfc, tox, toy, icox, icoy, di, mm;	// title variables
+	uint16_t ditc, difc, temptColor, bcolor;
+	bool hasIcon = false, moreup = false, moredown = false;
+	int i;
+	int totalID;
+	int MaxRow;
+	int currentID;
+	int cr;
+	byte debounce;
+	int sr, pr;
+#if MENU_ITEM_RAM
+	const unsigned char *itemBitmap[MAX_OPT];
+	const uint16_t *item565Bitmap[MAX_OPT];
+	uint8_t bmp_w[MAX_OPT];
+	uint8_t bmp_h[MAX_OPT];
+	byte IconType[MAX_OPT];
+#endif
+	bool rowselected = false;
+	bool drawTitleFlag = true;
+	bool redraw = false;
+	bool enablestate[MAX_OPT];
+	byte radius, thick;
+	uint16_t huw = HEADER_ZONE_W, hdw = HEADER_ZONE_W;	// header touch zones
+	uint8_t slop = TOUCH_SLOP;
+	MenuScroll scroll;
+	GFXcanvas1 *strip = nullptr;	// one row of text for drawing rows part way off the list
+	int16_t tx, ty;
+	bool caught = false;
+	MenuFrames fr;
+	bool pendnav = false, pendredraw = false, pendscroll = false;
+	uint8_t pendrow[MAX_OPT];	// style + 1 of a row waiting to be drawn, 0 if none
+	uint8_t gc = 0, gr = 0;		// grid columns and rows, no columns is the normal list
+	uint16_t gch;				// grid cell height
+	uint8_t slides = 0;			// highlight slide steps, 0 jumps
+	uint16_t slidems;
+	const MenuGlyphs *glyphs = nullptr;	// UTF-8 glyphs past the item font
+	const MenuIconAtlas *atlas = nullptr;
+	uint8_t aicon[MAX_OPT];		// atlas icon of each item, 0 uses the item's own bitmap
+	// idle, drawing is held off while idle and stale says the panel needs a redraw on wake
+	uint32_t idlems = 0, lastinput = 0;
+	uint8_t idlemode = IDLE_SLEEP;
+	bool idle = false, stale = false, waking = false;
+	void (*idlehook)(bool Idle) = nullptr;
+	MenuIdleStats ist;
+	// viewport, w of 0 is the whole screen, and the rectangles drawn since clearDamage
+	MenuRect view;
+	MenuRect dmg[MENU_DAMAGE];
+	uint8_t ndmg = 0;
+	// filter, the list has vn places, all totalID items or while filt is set the items vis[1..vn]
+#if MENU_FILTER
+	bool filt = false, fsub = false;
+	char fq[MAX_CHAR_LEN];
+	uint8_t fn = 0;
+	uint8_t vis[MAX_OPT], mlen[MAX_OPT], mpos[MAX_OPT];
+#endif
+	int vn = 0;
+	uint16_t fimr;		// rows the list has room for
+
+};
+
+// RAM budgets, a sketch that defines MENU_EDIT_BUDGET or MENU_ITEM_BUDGET (bytes a menu object may take)
+// before including the library fails to build when MAX_OPT, MAX_CHAR_LEN and the options make one bigger
+#ifdef MENU_EDIT_BUDGET
+static_assert(sizeof(EditMenu) <= MENU_EDIT_BUDGET, "EditMenu is over MENU_EDIT_BUDGET, lower MAX_OPT or MAX_CHAR_LEN or build with MENU_ITEM_RAM 0 or MENU_BIND 0");
+#endif
+#ifdef MENU_ITEM_BUDGET
+static_assert(sizeof(ItemMenu) <= MENU_ITEM_BUDGET, "ItemMenu is over MENU_ITEM_BUDGET, lower MAX_OPT or MAX_CHAR_LEN or build with MENU_ITEM_RAM 0 or MENU_FILTER 0");
+#endif
+
+
+#endif
@@ -0,0 +1,110 @@
+/*
+
+  value format timing, times EditMenu::formatValue (what the menu draws its values with) against
+  Print::print(float, places) over the same values and reports the us per value of each and
+  any value where the two give different text, over Serial, no display needs to be connected
+
+  Print::print(float) does a float multiply and a write per digit, formatValue scales once and
+  makes the digits from integers, the gap is widest on boards without a floating point unit
+
+*/
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_ST7735.h"
+#include "Adafruit_ST7735_Menu.h"
+
+#define VALUES 200		// values per pass
+#define PASSES 10
+
+// a Print that keeps what it is given, so both ways end up with the text in RAM
+class TextPrint : public Print {
+
+public:
+
+  size_t write(uint8_t c) {
+    if (n < (MENU_VALUE_LEN - 1)) {
+      text[n++] = c;
+      text[n] = 0;
+    }
+    return 1;
+  }
+
+  void clear() {
+    n = 0;
+    text[0] = 0;
+  }
+
+  char text[MENU_VALUE_LEN];
+  uint8_t n = 0;
+
+};
+
+float Values[VALUES];
+TextPrint Out;
+
+void report(uint8_t Places) {
+
+  char buf[MENU_VALUE_LEN];
+  uint32_t t0, tprint = 0, tformat = 0;
+  int i, p, diff = 0;
+
+  for (p = 0; p < PASSES; p++) {
+    t0 = micros();
+    for (i = 0; i < VALUES; i++) {
+      Out.clear();
+      Out.print(Values[i], Places);
+    }
+    tprint += micros() - t0;
+
+    t0 = micros();
+    for (i = 0; i < VALUES; i++) {
+      EditMenu::formatValue(buf, Values[i], Places);
+    }
+    tformat += micros() - t0;
+  }
+
+  // and the text has to be the same
+  for (i = 0; i < VALUES; i++) {
+    Out.clear();
+    Out.print(Values[i], Places);
+    EditMenu::formatValue(buf, Values[i], Places);
+    if (strcmp(buf, Out.text) != 0) {
+      diff++;
+    }
+  }
+
+  Serial.print(Places);
+  Serial.print(" places, print ");
+  Serial.print((float) tprint / (VALUES * PASSES), 2);
+  Serial.print(" us, formatValue ");
+  Serial.print((float) tformat / (VALUES * PASSES), 2);
+  Serial.print(" us, ");
+  Serial.print(diff);
+  Serial.println(" differ");
+
+}
+
+void setup() {
+
+  int i;
+
+  Serial.begin(9600);
+  while (!Serial && (millis() < 3000)) {
+  }
+
+  // what a menu holds, small settings to a few thousand, both signs
+  randomSeed(1);
+  for (i = 0; i < VALUES; i++) {
+    Values[i] = (random(-500000, 500000) / 100.0) * ((i % 4) ? 1.0 : 0.01);
+  }
+
+  Serial.println("us per value");
+  report(0);
+  report(1);
+  report(2);
+  report(3);
+
+}
+
+void loop() {
+}
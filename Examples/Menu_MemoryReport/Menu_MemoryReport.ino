@@ -0,0 +1,187 @@
+/*
+
+  memory report, prints what an EditMenu and an ItemMenu take in RAM field by field as the library
+  is built (MAX_OPT, MAX_CHAR_LEN, MENU_ITEM_RAM, MENU_BIND, MENU_FILTER) over Serial, no display
+  needs to be connected
+
+  the MENU_SIZE_ flags below pull each feature into the build so its flash cost can be measured,
+  extras/menusize.py compiles this sketch once per flag and prints what each one adds, for example
+
+    python3 extras/menusize.py --fqbn arduino:avr:mega --flash 60000 --ram 6000
+
+  uncomment MENU_EDIT_BUDGET / MENU_ITEM_BUDGET to have the build fail when a menu object gets
+  bigger than that many bytes
+
+*/
+
+//#define MENU_EDIT_BUDGET 2500
+//#define MENU_ITEM_BUDGET 2000
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_ST7735.h"
+#include "Adafruit_ST7735_Menu.h"
+
+// found in \Arduino\libraries\Adafruit-GFX-Library-master
+#include "fonts/FreeSans9pt7b.h"
+
+// features, 1 to build them in
+#ifndef MENU_SIZE_TOUCH
+#define MENU_SIZE_TOUCH 0		// touch menus, press() and touch() with drag and flick
+#endif
+#ifndef MENU_SIZE_FRAMES
+#define MENU_SIZE_FRAMES 0		// setFrameRate and tick
+#endif
+#ifndef MENU_SIZE_SLIDE
+#define MENU_SIZE_SLIDE 0		// highlight slide
+#endif
+#ifndef MENU_SIZE_IDLE
+#define MENU_SIZE_IDLE 0		// idle mode
+#endif
+#ifndef MENU_SIZE_GRID
+#define MENU_SIZE_GRID 0		// ItemMenu grid
+#endif
+#ifndef MENU_SIZE_BIND
+#define MENU_SIZE_BIND 0		// bound variables and refresh
+#endif
+#ifndef MENU_SIZE_DIGIT
+#define MENU_SIZE_DIGIT 0		// digit edit
+#endif
+#ifndef MENU_SIZE_FILTER
+#define MENU_SIZE_FILTER 0		// ItemMenu filter
+#endif
+#ifndef MENU_SIZE_LIST
+#define MENU_SIZE_LIST 0		// MenuList display list
+#endif
+#ifndef MENU_SIZE_CANVAS
+#define MENU_SIZE_CANVAS 0		// MenuCanvas frame buffer, boards with the RAM only
+#endif
+
+// a library built without bind or the filter (MENU_BIND 0, MENU_FILTER 0) has none to pull in
+#if !MENU_BIND
+#undef MENU_SIZE_BIND
+#define MENU_SIZE_BIND 0
+#endif
+#if !MENU_FILTER
+#undef MENU_SIZE_FILTER
+#define MENU_SIZE_FILTER 0
+#endif
+
+#define TFT_DC 9
+#define TFT_CS 10
+#define TFT_RST 8
+
+Adafruit_ST7735 Display = Adafruit_ST7735(TFT_CS, TFT_DC, TFT_RST);
+
+EditMenu SettingsMenu(&Display, MENU_SIZE_TOUCH);
+ItemMenu MainMenu(&Display, MENU_SIZE_TOUCH);
+
+// items from flash tables so the sketch also builds with MENU_ITEM_RAM 0
+const char MainText0[] PROGMEM = "Settings";
+const char MainText1[] PROGMEM = "Wireless";
+const char MainText2[] PROGMEM = "Servos";
+const char SettingsText0[] PROGMEM = "Gain";
+const char SettingsText1[] PROGMEM = "Address";
+
+const MenuItemDef MainItems[] PROGMEM = {
+  MenuNI(MainText0),
+  MenuNI(MainText1),
+  MenuNI(MainText2)
+};
+
+const MenuItemDef SettingsItems[] PROGMEM = {
+  MenuNI(SettingsText0, 1.5, 0, 10, 0.1, 1),
+  MenuNI(SettingsText1, 12, 0, 255, 1, 0)
+};
+
+#if MENU_SIZE_BIND
+float Gain = 1.5;
+#endif
+#if MENU_SIZE_LIST
+MenuList List(&Display);
+#endif
+#if MENU_SIZE_CANVAS
+MenuCanvas Canvas(&Display);
+#endif
+
+void setup() {
+
+  Serial.begin(9600);
+  while (!Serial && (millis() < 3000)) {
+  }
+
+  Display.initR(INITR_GREENTAB);
+  Display.setRotation(1);
+  Display.fillScreen(ST7735_BLACK);
+
+  MainMenu.init(ST7735_WHITE, ST7735_BLACK, ST7735_WHITE, ST7735_BLUE, 20, 5, "Main", FreeSans9pt7b, FreeSans9pt7b);
+  MainMenu.addItems(MainItems, 3);
+
+  SettingsMenu.init(ST7735_WHITE, ST7735_BLACK, ST7735_WHITE, ST7735_BLUE, ST7735_BLACK, ST7735_GREEN,
+                    100, 20, 5, "Settings", FreeSans9pt7b, FreeSans9pt7b);
+  SettingsMenu.addItems(SettingsItems, 2);
+
+#if MENU_SIZE_FRAMES
+  MainMenu.setFrameRate(30);
+  SettingsMenu.setFrameRate(30);
+#endif
+#if MENU_SIZE_SLIDE
+  MainMenu.setHighlightSlide(4, 40);
+  SettingsMenu.setHighlightSlide(4, 40);
+#endif
+#if MENU_SIZE_IDLE
+  MainMenu.setIdle(30000);
+  SettingsMenu.setIdle(30000);
+#endif
+#if MENU_SIZE_GRID
+  MainMenu.setGrid(3, 2, 50);
+#endif
+#if MENU_SIZE_BIND
+  SettingsMenu.bind(1, &Gain);
+#endif
+#if MENU_SIZE_DIGIT
+  SettingsMenu.setDigitEdit(true);
+#endif
+#if MENU_SIZE_LIST
+  MainMenu.setList(&List);
+  SettingsMenu.setList(&List);
+#endif
+#if MENU_SIZE_CANVAS
+  MainMenu.setCanvas(&Canvas);
+  SettingsMenu.setCanvas(&Canvas);
+#endif
+
+  MainMenu.draw();
+  MainMenu.MoveDown();
+  MainMenu.selectRow();
+#if MENU_SIZE_FILTER
+  MainMenu.filterKey('s');
+#endif
+  SettingsMenu.draw();
+  SettingsMenu.MoveDown();
+  SettingsMenu.selectRow();
+  SettingsMenu.MoveUp();
+#if MENU_SIZE_TOUCH
+  MainMenu.touch(80, 60, TOUCH_DOWN);
+  MainMenu.touch(80, 60, TOUCH_UP);
+  SettingsMenu.touch(80, 60, TOUCH_DOWN);
+  SettingsMenu.touch(80, 60, TOUCH_UP);
+#endif
+
+  EditMenu::memoryReport(Serial);
+  ItemMenu::memoryReport(Serial);
+
+}
+
+void loop() {
+#if MENU_SIZE_FRAMES || MENU_SIZE_IDLE
+  MainMenu.tick();
+  SettingsMenu.tick();
+#endif
+#if MENU_SIZE_BIND
+  Gain += 0.1;
+  SettingsMenu.refresh();
+#endif
+#if MENU_SIZE_CANVAS
+  Canvas.flush();
+#endif
+}
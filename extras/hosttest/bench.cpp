@@ -0,0 +1,132 @@
+/*
+
+  icon decode benchmark, raw 565 icons against the same icons packed (ICON_PACKED)
+
+  each icon is drawn on screen, where a packed icon goes out as runs in one address window,
+  and half off the left edge, where both kinds go pixel by pixel so the gap is the decode.
+  prints the ns per icon pixel on this machine and the panel calls each draw makes, and
+  checks the two kinds leave the same pixels. on a board the SPI bus sets the pace, build the
+  sketch with MENU_PROFILE 1 and compare drawPacked with draw565Bitmap there
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+// the icon draws are not public
+#define private public
+#include "host.h"
+#undef private
+
+#define DRAWS 2000
+
+static Adafruit_ST7735 D, E;
+
+// packs a 565 icon the way extras/packicon.py does
+static std::vector<unsigned char> pack(const uint16_t *Px, int N) {
+
+  std::vector<uint16_t> pal;
+  std::vector<unsigned char> out;
+  int i, k, run;
+
+  for (i = 0; i < N; i++) {
+    for (k = 0; (k < (int) pal.size()) && (pal[k] != Px[i]); k++) {
+    }
+    if (k == (int) pal.size()) {
+      pal.push_back(Px[i]);
+    }
+  }
+  out.push_back(pal.size());
+  for (k = 0; k < (int) pal.size(); k++) {
+    out.push_back(pal[k] & 0xFF);
+    out.push_back(pal[k] >> 8);
+  }
+  int most = (pal.size() <= 16) ? 16 : 256;
+  for (i = 0; i < N; i += run) {
+    for (run = 1; (i + run < N) && (Px[i + run] == Px[i]) && (run < most); run++) {
+    }
+    for (k = 0; pal[k] != Px[i]; k++) {
+    }
+    if (pal.size() <= 16) {
+      out.push_back(((run - 1) << 4) | k);
+    }
+    else {
+      out.push_back(run - 1);
+      out.push_back(k);
+    }
+  }
+  return out;
+
+}
+
+// rings around the middle, Colors of them
+static void rings(uint16_t *Px, int W, int Colors) {
+  for (int y = 0; y < W; y++) {
+    for (int x = 0; x < W; x++) {
+      int d = (abs(2 * x - W + 1) > abs(2 * y - W + 1)) ? abs(2 * x - W + 1) : abs(2 * y - W + 1);
+      int c = (d * Colors) / (W + 1);
+      Px[y * W + x] = (uint16_t) (0x0841 * (c + 1)) ^ (c * 0x3A5);
+    }
+  }
+}
+
+// panel calls since g_stats was cleared, a window, a burst or a lone pixel each
+static long sends() {
+  return g_stats.windows + g_stats.bursts + (g_stats.pixels - g_stats.burstpx);
+}
+
+template<class F> static double ns(F Draw) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int k = 0; k < DRAWS; k++) {
+    Draw();
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / DRAWS;
+}
+
+int main() {
+
+  static EditMenu m(&D);
+  static const int sizes[][2] = {{12, 4}, {32, 6}, {32, 40}};
+  static uint16_t px[32 * 32];
+  int fails = 0;
+
+  m.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 90, 18, 4, "Bench", TestFont, TestFont);
+
+  printf("                  bytes      on screen ns/px   clipped ns/px    panel calls\n");
+  printf("icon            raw packed      raw packed      raw packed      raw packed\n");
+  for (auto &s : sizes) {
+    int w = s[0], n = w * w;
+    rings(px, w, s[1]);
+    std::vector<unsigned char> pk = pack(px, n);
+
+    double r0 = ns([&] { m.draw565Bitmap(10, 10, px, w, w); }) / n;
+    double p0 = ns([&] { m.drawPackedBitmap(10, 10, pk.data(), w, w); }) / n;
+    double r1 = ns([&] { m.draw565Bitmap(-w / 2, 60, px, w, w); }) / n;
+    double p1 = ns([&] { m.drawPackedBitmap(-w / 2, 60, pk.data(), w, w); }) / n;
+
+    // what one draw of each sends, and that the screens match
+    D.fillScreen(0);
+    g_stats = CallStats();
+    m.draw565Bitmap(10, 10, px, w, w);
+    long craw = sends();
+    memcpy(E.fb, D.fb, D.width() * D.height() * sizeof(uint16_t));
+    D.fillScreen(0);
+    g_stats = CallStats();
+    m.drawPackedBitmap(10, 10, pk.data(), w, w);
+    long cpk = sends();
+    int16_t x0, y0, x1, y1;
+    if (screenDiff(D, E, x0, y0, x1, y1)) {
+      printf("FAIL %dx%d %d colors: packed and raw differ\n", w, w, s[1]);
+      fails++;
+    }
+
+    printf("%2dx%-2d %2d colors %5d %6d %8.2f %6.2f %8.2f %6.2f %8ld %6ld\n",
+           w, w, s[1], n * 2, (int) pk.size(), r0, p0, r1, p1, craw, cpk);
+  }
+
+  return fails ? 1 : 0;
+
+}
@@ -0,0 +1,325 @@
+/*
+
+  fuzz test of the navigation and touch state machines
+
+  builds random menus (item kinds, icons, grids, frame rate, slides, idle, digit edit, filters)
+  and throws random key, press, touch, tick, enable/disable, layout, filter and add events at
+  them, after every event the menu has to hold its invariants
+
+    currentID in 0..totalID, sr >= 0, cr in 0..imr (list mode)
+    totalID stays the item count, a filter shows vn of them
+    the keypad is only up while a row is being edited
+    the filter list is sorted item IDs that exist
+    the scroll strip, once made, is as wide and as high as a row of the layout now
+    one event draws at most WORK pixels (no runaway repaint loops)
+    one menu's whole run takes under 2 seconds (no hangs)
+
+  the sanitizers catch anything out of bounds, a failure prints the seed, the run and the
+  events that led to it, fuzz SEED RUNS replays the same runs
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <new>
+#include <signal.h>
+#include <unistd.h>
+
+// the invariants look at menu state the sketch never needs
+#define private public
+#include "host.h"
+#undef private
+
+#define WORK 400000L
+
+static Adafruit_ST7735 D;
+static const char *list[] = {"Off", "On", "Auto"};
+static float fv = 1.5;
+static int32_t iv = 3;
+static uint8_t uv = 2;
+
+// the events of the current run, printed when it fails
+static char trail[4096];
+static int ntrail;
+static int seed, run, bad;
+
+static void note(const char *Format, ...) {
+  va_list a;
+  int room = (int) sizeof(trail) - ntrail;
+  if (room <= 1) return;
+  va_start(a, Format);
+  int n = vsnprintf(trail + ntrail, room, Format, a);
+  va_end(a);
+  ntrail += (n < room) ? n : room - 1;
+}
+
+static void report(const char *What) {
+  fprintf(stderr, "seed %d run %d: %s after %s\n", seed, run, What, trail);
+}
+
+static void onAlarm(int) {
+  report("HANG");
+  _exit(3);
+}
+
+extern "C" void __sanitizer_set_death_callback(void (*)(void));
+static void onDeath() {
+  report("DIED");
+}
+
+// xorshift, the same runs on every platform
+static uint32_t state;
+static uint32_t R(uint32_t N) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state % N;
+}
+
+#define INV(c) do { if (!(c)) { report("INVARIANT " #c); bad++; return false; } } while (0)
+
+// a strip left over from an earlier layout draws rows at the old width
+template<class M> static bool stripFits(M &m) {
+  int16_t x0 = m.view.w ? m.icox : ((m.icox < m.isx) ? m.icox : m.isx);
+  return (!m.strip) || ((m.strip->width() == m.irw - x0) && (m.strip->height() == m.irh));
+}
+
+static bool check(EditMenu &m) {
+  INV((m.currentID >= 0) && (m.currentID <= m.totalID));
+  INV(m.sr >= 0);
+  INV((m.cr >= 0) && (m.cr <= (int) m.imr));
+  INV((m.kp.w == 0) || m.rowselected);
+  INV(stripFits(m));
+  return true;
+}
+
+static bool check(ItemMenu &m) {
+  INV((m.currentID >= 0) && (m.currentID <= m.vn));
+  INV(m.sr >= 0);
+  if (m.gc == 0) {
+    INV((m.cr >= 0) && (m.cr <= (int) m.imr));
+  }
+  if (m.filt) {
+    INV(m.vn <= m.totalID);
+    for (int p = 1; p <= m.vn; p++) {
+      INV((m.vis[p] >= 1) && (m.vis[p] <= m.totalID) && ((p == 1) || (m.vis[p] > m.vis[p - 1])));
+    }
+  }
+  else {
+    INV(m.vn == m.totalID);
+  }
+  INV(stripFits(m));
+  return true;
+}
+
+// a layout setter after the menu is up, then the draw it needs
+template<class M> static void layout(M &m) {
+  int x = R(20), y = R(20);
+  switch (R(3)) {
+    case 0:
+      note("M%d,%d ", x, 120 + y * 2);
+      m.setMenuBarMargins(x, 120 + y * 2, R(4), R(3));
+      break;
+    case 1:
+      note("I%d,%d ", x / 2, y / 4);
+      m.setIconMargins(x / 2, y / 4);
+      break;
+    case 2:
+      note("V%d,%d ", x, y);
+      m.setViewport(x, y, 160 - x - R(40), 128 - y - R(30));
+      break;
+  }
+  m.draw();
+}
+
+// events both menus take
+template<class M> static void event(M &m, int Op) {
+  int id = (int) R(MAX_OPT + 4) - 2;
+  int x = (int) R(180) - 10, y = (int) R(150) - 10, e = 1 + R(3);
+  MenuHit h;
+  switch (Op) {
+    case 0: note("D "); m.MoveDown(); break;
+    case 1: note("U "); m.MoveUp(); break;
+    case 2: note("S "); m.selectRow(); break;
+    case 3: note("p%d,%d ", x, y); m.press(x, y); break;
+    case 4: note("t%d,%d,%d ", x, y, e); m.touch(x, y, e); break;
+    case 5: note("u "); g_millis += R(50); m.updateScroll(); break;
+    case 6: note("k "); g_micros += R(100000); g_millis += R(100); m.tick(); break;
+    case 7: note("W "); m.draw(); break;
+    case 8: if ((id >= 1) && (id <= m.totalID)) { note("x%d ", id); m.disable(id); } break;
+    case 9: if ((id >= 1) && (id <= m.totalID)) { note("e%d ", id); m.enable(id); } break;
+    case 10: note("i%d ", id); m.setInitialItem(id); break;
+    case 11: note("h%d,%d ", x, y); m.hitTest(x, y, h); break;
+    case 12: layout(m); break;
+  }
+}
+
+static void fuzzEdit(int N, bool Touch) {
+
+  static char mem[sizeof(EditMenu)];
+  // fields the constructor leaves alone start as junk, like a menu on the stack
+  memset(mem, 0xA5, sizeof(mem));
+  EditMenu &m = *new(mem) EditMenu(&D, Touch);
+
+  m.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 90, 18, 1 + R(6), "T", TestFont, TestFont);
+  for (int i = 0; i < N; i++) {
+    switch (R(7)) {
+      case 0: m.addNI("a", i, 0, 9, 1, 0); break;
+      case 1: m.add565("b", 1, 0, 3, 1, 0, list, BOX_565, 12, 12); break;
+      case 2: m.addMono("c", i, -5, 5, 0.5, 1, NULL, BOX_MONO, 12, 12); break;
+      case 3: m.addNI("d", 0, 0, 3, 1, 0, list); break;
+      case 4: m.addToggle("e", i % 2); break;
+      case 5: m.addEnum("f", 1, list, 3); break;
+      case 6: m.addInt("g", 20000001, -5, 20000005, 3); break;
+    }
+  }
+  if ((N > 0) && (R(3) == 0)) {
+    switch (R(3)) {
+      case 0: m.bind(1 + R(N), &fv); break;
+      case 1: m.bind(1 + R(N), &iv); break;
+      case 2: m.bind(1 + R(N), &uv); break;
+    }
+  }
+  if (R(3) == 0) m.setFrameRate(30);
+  if (R(4) == 0) m.setHighlightSlide(3, 20);
+  if (R(4) == 0) m.setIdle(500);
+  if (R(4) == 0) m.setValueWidth(30);
+  if (R(2)) m.setDigitEdit(true);
+  if (R(3) == 0) {
+    for (int i = 1; i <= N; i++) if (R(2)) m.disable(i);
+  }
+
+  D.fillScreen(0);
+  alarm(2);
+  note("W ");
+  m.draw();
+  for (int k = 0; k < 60; k++) {
+    long p0 = g_stats.pixels;
+    event(m, R(13));
+    if (k % 10 == 0) {
+      fv += 1;
+      iv++;
+      m.refresh();
+    }
+    if (!check(m)) break;
+    if (g_stats.pixels - p0 > WORK) {
+      report("WORK");
+      bad++;
+      break;
+    }
+  }
+  alarm(0);
+  m.~EditMenu();
+
+}
+
+static void fuzzItem(int N, bool Touch) {
+
+  static char mem[sizeof(ItemMenu)];
+  static const char *names[] = {"ab", "Ba", "cab", "b", "abc"};
+  static const char *texts[] = {"", "a", "ab", "b", "ca", "x"};
+  memset(mem, 0xA5, sizeof(mem));
+  ItemMenu &m = *new(mem) ItemMenu(&D, Touch);
+
+  m.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 18, 1 + R(6), "T", TestFont, TestFont);
+  for (int i = 0; i < N; i++) {
+    const char *t = names[R(5)];
+    switch (R(4)) {
+      case 0: m.addNI(t); break;
+      case 1: m.add565(t, BOX_565, 12, 12); break;
+      case 2: m.addMono(t, BOX_MONO, 12, 12); break;
+      case 3: m.addPacked(t, BOX_PACKED, 12, 12); break;
+    }
+  }
+  if (R(3) == 0) m.setGrid(1 + R(4), 1 + R(3), 30);
+  if (R(3) == 0) m.setFrameRate(30);
+  if (R(4) == 0) m.setHighlightSlide(3, 20);
+  if (R(4) == 0) m.setIdle(500);
+  if (R(3) == 0) {
+    for (int i = 1; i <= N; i++) if (R(2)) m.disable(i);
+  }
+
+  D.fillScreen(0);
+  alarm(2);
+  note("W ");
+  m.draw();
+  for (int k = 0; k < 60; k++) {
+    long p0 = g_stats.pixels;
+    int op = R(19);
+    if (op == 13) {
+      note("L ");
+      m.MoveLeft();
+    }
+    else if (op == 14) {
+      note("R ");
+      m.MoveRight();
+    }
+    else if (op == 15) {
+      char c = "abcB\b"[R(5)];
+      note("f%c ", c);
+      m.filterKey(c);
+    }
+    else if (op == 16) {
+      const char *t = texts[R(6)];
+      bool sub = R(2);
+      note("F%s,%d ", t, sub);
+      m.setFilter(t, sub);
+    }
+    else if (op == 17) {
+      // an item added while the list is filtered
+      if (m.totalID < MAX_OPT - 1) {
+        note("a ");
+        m.addNI(names[R(5)]);
+      }
+    }
+    else if (op == 18) {
+      // a grid turned on or off after the menu is up
+      int c = R(2) ? 0 : 1 + R(4);
+      note("g%d ", c);
+      m.setGrid(c, 1 + R(3), 30);
+    }
+    else {
+      event(m, op);
+    }
+    if (!check(m)) break;
+    if (g_stats.pixels - p0 > WORK) {
+      report("WORK");
+      bad++;
+      break;
+    }
+  }
+  alarm(0);
+  m.~ItemMenu();
+
+}
+
+int main(int argc, char **argv) {
+
+  int runs;
+
+  seed = (argc > 1) ? atoi(argv[1]) : 1;
+  runs = (argc > 2) ? atoi(argv[2]) : 500;
+  state = 2463534242u + seed;
+
+  signal(SIGALRM, onAlarm);
+  __sanitizer_set_death_callback(onDeath);
+
+  for (run = 0; run < runs; run++) {
+    int n = R(MAX_OPT);		// items, can be none
+    bool touch = R(2);
+    ntrail = 0;
+    trail[0] = 0;
+    note("[%s touch %d items %d] ", (run % 2) ? "item" : "edit", touch, n);
+    if (run % 2) {
+      fuzzItem(n, touch);
+    }
+    else {
+      fuzzEdit(n, touch);
+    }
+  }
+
+  printf("fuzz seed %d, %d runs, %d failed\n", seed, runs, bad);
+  return bad ? 1 : 0;
+
+}
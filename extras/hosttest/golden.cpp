@@ -0,0 +1,612 @@
+/*
+
+  golden image tests, scripted menus drawn on the stub display
+
+  each scenario plays a script of inputs against a menu, every step is logged with the hash of
+  the screen and the draw calls it took (pixels sent, fills, characters, address windows) and
+  the log is compared with golden/<scenario>.txt, the last screen with golden/<scenario>.fb
+  pixel by pixel. most scenarios also run a twin, a second menu given the same inputs and
+  drawn whole with draw() after each step, so any repaint that leaves the screen different from
+  a full draw fails at once, golden or not
+
+    golden                 run every scenario
+    golden edit_list ...   run some
+    golden --update        write the logs and images again, after a change meant to alter them
+    golden --ppm DIR       also write the last screen of each scenario as DIR/<scenario>.ppm,
+                           and both screens of a step that differs from the full draw
+
+  script steps, separated by spaces
+    D U S L R      MoveDown MoveUp selectRow MoveLeft MoveRight
+    W              draw()
+    r              refresh() on an EditMenu
+    k              50 ms pass, then tick() and updateScroll()
+    pX,Y           press(X, Y), then drawRow() on the item it returns
+    tX,Y,E         touch(X, Y, E) 20 ms after the step before, E 1 down 2 move 3 up
+    fC b Ftext     filterKey(C), filterKey('\b'), setFilter(text)
+    TN             setItemText(N, "renamed") on an ItemMenu
+    xN GN          disable(N), setGrid(N, 2, 40) on an ItemMenu
+    C              clear the screen, as a sketch does before drawing a new layout
+
+*/
+
+#include <string>
+#include <functional>
+#include "host.h"
+
+static Adafruit_ST7735 D, T;			// screen under test and the twin's
+static std::string steps;
+static int fails = 0;
+static std::function<void()> after;		// runs after each step on the menu under test
+static const char *ppm = nullptr;
+
+static void fail(const char *Scenario, const char *Step, int N, const char *What) {
+  printf("FAIL %s step %d (%s): %s\n", Scenario, N, Step, What);
+  fails++;
+}
+
+template<class M> static void common(M &m, const char *t) {
+  int x, y, e;
+  switch (t[0]) {
+    case 'D': m.MoveDown(); break;
+    case 'U': m.MoveUp(); break;
+    case 'S': m.selectRow(); break;
+    case 'W': m.draw(); break;
+    case 'k': m.tick(); m.updateScroll(); break;
+    case 't':
+      sscanf(t + 1, "%d,%d,%d", &x, &y, &e);
+      m.touch(x, y, e);
+      break;
+  }
+}
+
+static void apply(EditMenu &m, const char *t) {
+  int x, y, id;
+  if (t[0] == 'p') {
+    sscanf(t + 1, "%d,%d", &x, &y);
+    id = m.press(x, y);
+    if (id > 0) m.drawRow(id);
+    return;
+  }
+  if (t[0] == 'r') {
+    m.refresh();
+    return;
+  }
+  common(m, t);
+}
+
+static void apply(ItemMenu &m, const char *t) {
+  int x, y, id;
+  switch (t[0]) {
+    case 'p':
+      sscanf(t + 1, "%d,%d", &x, &y);
+      id = m.press(x, y);
+      if (id > 0) m.drawRow(id, BUTTON_NOTPRESSED);
+      break;
+    case 'L': m.MoveLeft(); break;
+    case 'R': m.MoveRight(); break;
+    case 'f': m.filterKey(t[1]); break;
+    case 'b': m.filterKey('\b'); break;
+    case 'F': m.setFilter(t + 1); break;
+    case 'T': m.setItemText(atoi(t + 1), "renamed"); break;
+    case 'x': m.disable(atoi(t + 1)); break;
+    case 'G': m.setGrid(atoi(t + 1), 2, 40); break;
+    default: common(m, t);
+  }
+}
+
+// steps whose screen a full draw should match
+static bool twinned(EditMenu &, const char *t) {
+  // a drag in flight is drawn in strips, draw() would snap it to whole rows
+  return t[0] != 't';
+}
+
+static bool twinned(ItemMenu &, const char *t) {
+  // drawRow() of a touched item prints in the highlight text color, draw() in the text color,
+  // disable() and setGrid() draw nothing and a cleared screen waits for the draw() after it
+  return (t[0] != 't') && (t[0] != 'p') && (t[0] != 'x') && (t[0] != 'G') && (t[0] != 'C');
+}
+
+// plays Script on A, and on the twin B when there is one
+template<class M> static void play(const char *Name, M &A, M *B, const char *Script) {
+
+  char t[32];
+  const char *s = Script;
+  int n = 0, k;
+  int16_t x0, y0, x1, y1;
+  char buf[160];
+
+  while (*s) {
+    while (*s == ' ') s++;
+    for (k = 0; s[k] && (s[k] != ' ') && (k < 31); k++) t[k] = s[k];
+    t[k] = 0;
+    s += k;
+    if (!k) break;
+    n++;
+
+    // the clock moves once a step, both menus see the same time
+    if (t[0] == 'k') {
+      g_millis += 50;
+      g_micros += 50000;
+    }
+    if (t[0] == 't') {
+      g_millis += 20;
+      g_micros += 20000;
+    }
+
+    g_stats = CallStats();
+    if (t[0] == 'C') {
+      D.fillScreen(0);
+    }
+    apply(A, t);
+    if (after) after();
+    snprintf(buf, sizeof(buf), "%-10s %08x px %ld fill %ld char %ld win %ld\n", t, screenHash(D),
+             g_stats.pixels, g_stats.fills, g_stats.chars, g_stats.windows);
+    steps += buf;
+
+    if (B) {
+      apply(*B, t);
+      if (!twinned(A, t)) {
+        continue;
+      }
+      T.fillScreen(0);
+      B->draw();
+      k = screenDiff(D, T, x0, y0, x1, y1);
+      if (k) {
+        snprintf(buf, sizeof(buf), "%d pixels differ from a full draw in %d,%d to %d,%d", k, x0, y0, x1, y1);
+        fail(Name, t, n, buf);
+        if (ppm) {
+          snprintf(buf, sizeof(buf), "%s/%s-%d.ppm", ppm, Name, n);
+          writePPM(buf, D);
+          snprintf(buf, sizeof(buf), "%s/%s-%d-full.ppm", ppm, Name, n);
+          writePPM(buf, T);
+        }
+      }
+    }
+  }
+
+}
+
+// scenarios, each sets up its menus on D (and T) and plays a script
+
+static void editItems(EditMenu &E) {
+  static const char *list[] = {"Off", "On", "Auto"};
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Edit", TestFont, TestFont);
+  for (int k = 0; k < 9; k++) {
+    if (k % 3 == 0) E.add565("abc", k, 0, 10, 1, 0, NULL, BOX_565, 12, 12);
+    else if (k % 3 == 1) E.addMono("mm", 1, 0, 3, 1, 0, list, BOX_MONO, 12, 12);
+    else E.addNI("val", 2.5, -5, 5, 0.25, 2);
+  }
+  E.disable(5);
+  E.setTitleBarSize(0, 0, 160, 30);
+  E.setItemTextMargins(4, 12, 3);
+  E.setIconMargins(0, 0);
+  E.setMenuBarMargins(2, 158, 0, 1);
+  E.setItemColors(0x4444, 0x5555, 0x6666);
+}
+
+static const char *editScript = "W D D D D S U U U S D S D D D D D D D D S D D S U U U U U U U U U U U U U D D D S";
+
+#define TWIN(Type, Touch) \
+  static Type A(&D, Touch), B(&T, Touch); \
+  D.fillScreen(0); \
+  T.fillScreen(0)
+
+static void editList() {
+  TWIN(EditMenu, false);
+  editItems(A);
+  editItems(B);
+  play("edit_list", A, &B, editScript);
+}
+
+static void editFrames() {
+  TWIN(EditMenu, false);
+  editItems(A);
+  editItems(B);
+  A.setFrameRate(30);
+  // one frame's time then the tick that draws it
+  after = [&]() { g_micros += 40000; A.tick(); };
+  play("edit_frames", A, &B, editScript);
+}
+
+static void editSlide() {
+  TWIN(EditMenu, false);
+  editItems(A);
+  editItems(B);
+  A.setHighlightSlide(3, 30);
+  play("edit_slide", A, &B, editScript);
+}
+
+static void editCanvas() {
+  TWIN(EditMenu, false);
+  static MenuCanvas C(&D);
+  editItems(A);
+  editItems(B);
+  A.setCanvas(&C);
+  after = [&]() { C.flush(); };
+  play("edit_canvas", A, &B, editScript);
+}
+
+static void editOps() {
+  TWIN(EditMenu, false);
+  static MenuList L(&D);
+  editItems(A);
+  editItems(B);
+  A.setList(&L);
+  play("edit_ops", A, &B, "W W D W D D W S U W S W U U W W");
+}
+
+static void editViewport() {
+  TWIN(EditMenu, false);
+  editItems(A);
+  editItems(B);
+  A.setViewport(20, 10, 120, 100);
+  B.setViewport(20, 10, 120, 100);
+  play("edit_viewport", A, &B, "W D D D D D D S U S D D D D U U U U U U U");
+}
+
+static void digitItems(EditMenu &E) {
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Digits", TestFont, TestFont);
+  E.addNI("val", 9.5, -20, 120, 0.25, 2);
+  E.addNI("int", 95, 0, 5000, 1, 0);
+  E.setTitleBarSize(0, 0, 160, 30);
+  E.setItemTextMargins(4, 12, 3);
+  E.setMenuBarMargins(2, 158, 0, 1);
+  E.setDigitEdit(true);
+}
+
+static void editDigit() {
+  TWIN(EditMenu, false);
+  digitItems(A);
+  digitItems(B);
+  play("edit_digit", A, &B, "W S U S S U U U U U U U U S D D S D D D S U U U U U D S D S D S D S D S");
+}
+
+static void editKeypad() {
+  TWIN(EditMenu, true);
+  digitItems(A);
+  digitItems(B);
+  // the int row, then 4 3 2 1 on the keypad below it, back two, 0, close
+  play("edit_keypad", A, &B, "W p100,55 p20,78 p124,91 p72,91 p20,91 p124,117 p124,117 p72,117 p100,55");
+}
+
+static void typedItems(EditMenu &E) {
+  static const char *modes[] = {"Off", "On", "Automatic"};
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Typed", TestFont, TestFont);
+  E.addToggle("led", true);
+  E.addEnum("mode", 2, modes, 3);
+  E.addInt("count", 7, -3, 9, 2);
+  E.addNI("gain", 1.5, 0, 10, 0.5, 1);
+  E.setTitleBarSize(0, 0, 160, 30);
+  E.setItemTextMargins(4, 12, 3);
+  E.setMenuBarMargins(2, 158, 0, 1);
+}
+
+static void editTyped() {
+  TWIN(EditMenu, false);
+  typedItems(A);
+  typedItems(B);
+  play("edit_typed", A, &B, "W S S D S U D D S D S U U U S D S U U S");
+}
+
+// ints past 2^24, where a float can't hold every whole number, in a flash table and the twin
+// added one by one, both have to show the same exact values
+static const MenuItemDef bigTable[] = {
+  MenuInt("big", 20000001, -20000005, 20000005, 3),
+  MenuInt("huge", 2000000001, 0, 2000000009, 1),
+  MenuNI("gain", 1.5, 0, 10, 0.5, 1),
+};
+
+static void bigItems(EditMenu &E, bool Table) {
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 70, 20, 4, "Big", TestFont, TestFont);
+  if (Table) {
+    E.addItems(bigTable, 3);
+  }
+  else {
+    E.addInt("big", 20000001, -20000005, 20000005, 3);
+    E.addInt("huge", 2000000001, 0, 2000000009, 1);
+    E.addNI("gain", 1.5, 0, 10, 0.5, 1);
+  }
+  E.setTitleBarSize(0, 0, 160, 30);
+  E.setItemTextMargins(4, 12, 3);
+  E.setMenuBarMargins(2, 158, 0, 1);
+}
+
+static void editBigInt() {
+  TWIN(EditMenu, false);
+  bigItems(A, true);
+  bigItems(B, false);
+  // steps, a wrap past each limit and the other item, drawn whole between them
+  play("edit_bigint", A, &B, "W S U W U W D W S D S U U W S U");
+  // a digit edit of the first, the sign flipped and the last digit rolled down
+  A.setDigitEdit(true);
+  B.setDigitEdit(true);
+  play("edit_bigint", A, &B, "S D S S S S S S S S D S W");
+}
+
+// the same items bound to int32s, refresh() has to see a change of one past 2^24
+static void editBound() {
+  TWIN(EditMenu, false);
+  static int32_t big[2], huge[2];
+  static const int32_t vals[][2] = {{20000003, 2000000001}, {20000002, 2000000002}, {20000003, 2000000003}};
+  bigItems(A, true);
+  bigItems(B, false);
+  big[0] = big[1] = 20000002;
+  huge[0] = huge[1] = 2000000002;
+  A.bind(1, &big[0]);
+  B.bind(1, &big[1]);
+  A.bind(2, &huge[0]);
+  B.bind(2, &huge[1]);
+  play("edit_bound", A, &B, "W");
+  for (auto &s : vals) {
+    big[0] = big[1] = s[0];
+    huge[0] = huge[1] = s[1];
+    play("edit_bound", A, &B, "r");
+    if ((A.getInt(1) != s[0]) || (A.getInt(2) != s[1])) {
+      fail("edit_bound", "r", 0, "refresh() missed a bound int32 past 2^24");
+    }
+  }
+}
+
+// list texts past ASCII drawn from a glyph font, the edit repaints them as a full draw does
+static void glyphItems(EditMenu &E) {
+  static GFXglyph g[2] = {{0, 5, 7, 6, 0, -6}, {0, 5, 7, 6, 0, -6}};
+  static const uint16_t code[] = {0x00B0, 0x00E9};
+  static const MenuGlyphs glyphs = {code, {nullptr, g, 0x80, 0x81, 10}};
+  static const char *list[] = {"Caf\xC3\xA9", "Th\xC3\xA9", "90\xC2\xB0"};
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Glyphs", TestFont, TestFont);
+  E.addNI("drink", 0, 0, 3, 1, 0, list);
+  E.addNI("angle", 2, 0, 3, 1, 0, list);
+  E.setTitleBarSize(0, 0, 160, 30);
+  E.setItemTextMargins(4, 12, 3);
+  E.setMenuBarMargins(2, 158, 0, 1);
+  E.setGlyphs(&glyphs);
+}
+
+static void editGlyphs() {
+  TWIN(EditMenu, false);
+  glyphItems(A);
+  glyphItems(B);
+  play("edit_glyphs", A, &B, "W S U U S D S D S");
+  // setValueWidth() forgets what the value cell holds, so each step of the edit repaints it whole
+  A.setValueWidth(60);
+  B.setValueWidth(60);
+  D.fillScreen(0);
+  after = [&]() { A.setValueWidth(60); };
+  play("edit_glyphs", A, &B, "W S U U U S");
+}
+
+static void editTouch() {
+  TWIN(EditMenu, true);
+  editItems(A);
+  editItems(B);
+  // rows, the header arrows, a drag up and a flick down
+  play("edit_touch", A, &B, "W p100,45 p100,45 p100,65 p10,15 p150,15 p150,15 "
+       "t100,100,1 t100,90,2 t100,75,2 t100,60,2 t100,60,3 W "
+       "t100,40,1 t100,70,2 t100,100,3 k k k k k k k k W p100,65 p100,65");
+}
+
+static void editZones() {
+  TWIN(EditMenu, true);
+  editItems(A);
+  editItems(B);
+  // arrow zones off the default width get their arrows centered, then a tap in each
+  A.setHeaderZones(24, 60);
+  B.setHeaderZones(24, 60);
+  play("edit_zones", A, &B, "W p20,15 p110,15 p110,15");
+}
+
+static void itemItems(ItemMenu &I) {
+  I.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 25, 3, "Items", TestFont, TestFont);
+  for (int k = 0; k < 7; k++) {
+    if (k % 2) I.add565("it", BOX_565, 12, 12);
+    else I.addNI("plain");
+  }
+  I.disable(4);
+  I.setTitleBarSize(0, 0, 160, 30);
+  I.setItemTextMargins(4, 12, 3);
+}
+
+static void itemList() {
+  TWIN(ItemMenu, false);
+  itemItems(A);
+  itemItems(B);
+  play("item_list", A, &B, "W D D D D D D D D D U U U U U U U U U U U U D D S T3 T2 T4 T7");
+}
+
+static void itemTouch() {
+  TWIN(ItemMenu, true);
+  itemItems(A);
+  itemItems(B);
+  play("item_touch", A, &B, "W p100,45 p100,65 t100,100,1 t100,80,2 t100,60,2 t100,60,3 W "
+       "t100,100,1 t100,60,2 t100,40,3 k k k k k k k k W t100,40,1 t100,90,2 t100,100,3 k k k k k k W p100,45");
+}
+
+static void itemGrid() {
+  TWIN(ItemMenu, false);
+  itemItems(A);
+  itemItems(B);
+  A.setGrid(3, 2, 40);
+  B.setGrid(3, 2, 40);
+  play("item_grid", A, &B, "W R R R R D D L U U R R R R R R S R R x5 x6 x7 W L R R G0 C W D U G3 C W");
+}
+
+static void filterItems(ItemMenu &I) {
+  static const char *names[] = {"Settings", "Servos", "Sensors", "Wireless", "Display", "Sound", "Storage", "System"};
+  I.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 20, 4, "Main", TestFont, TestFont);
+  for (int k = 0; k < 8; k++) I.addNI(names[k]);
+  I.setTitleBarSize(0, 0, 160, 30);
+  I.setItemTextMargins(4, 12, 3);
+}
+
+static void itemFilter() {
+  TWIN(ItemMenu, false);
+  filterItems(A);
+  filterItems(B);
+  play("item_filter", A, &B, "W D D fS D fe b b fs fy b b F W D D D S");
+}
+
+static void itemPacked() {
+  // the twin has the same icon raw, packed icons have to come out the same
+  TWIN(ItemMenu, false);
+  A.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 25, 3, "Icons", TestFont, TestFont);
+  B.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 25, 3, "Icons", TestFont, TestFont);
+  for (int k = 0; k < 6; k++) {
+    A.addPacked("icon", BOX_PACKED, 12, 12);
+    B.add565("icon", BOX_565, 12, 12);
+  }
+  A.setTitleBarSize(0, 0, 160, 30);
+  B.setTitleBarSize(0, 0, 160, 30);
+  play("item_packed", A, &B, "W D D D D D U U U U U U");
+}
+
+static void itemAtlas() {
+  // icons cut from one sheet, the twin has each one as its own 565 bitmap
+  static uint16_t sheet[24 * 12], ramp[144];
+  static const MenuIconRect rects[] = {{0, 0, 12, 12}, {12, 0, 12, 12}};
+  static const MenuIconAtlas atlas = {ICON_565, sheet, 24, rects, 2};
+  for (int y = 0; y < 12; y++) {
+    for (int x = 0; x < 12; x++) {
+      ramp[y * 12 + x] = (x + y) * 0x0841;
+      sheet[y * 24 + x] = BOX_565[y * 12 + x];
+      sheet[y * 24 + 12 + x] = ramp[y * 12 + x];
+    }
+  }
+  TWIN(ItemMenu, false);
+  A.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 25, 3, "Atlas", TestFont, TestFont);
+  B.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, 25, 3, "Atlas", TestFont, TestFont);
+  A.setIconAtlas(&atlas);
+  for (int k = 1; k <= 5; k++) {
+    A.addNI("icon");
+    A.setItemIcon(k, 1 + (k % 2));
+    B.add565("icon", (k % 2) ? ramp : BOX_565, 12, 12);
+  }
+  A.setTitleBarSize(0, 0, 160, 30);
+  B.setTitleBarSize(0, 0, 160, 30);
+  play("item_atlas", A, &B, "W D D D D U U U U U");
+}
+
+struct Scenario {
+  const char *name;
+  void (*run)();
+};
+
+static const Scenario scenarios[] = {
+  {"edit_list", editList},
+  {"edit_frames", editFrames},
+  {"edit_slide", editSlide},
+  {"edit_canvas", editCanvas},
+  {"edit_ops", editOps},
+  {"edit_viewport", editViewport},
+  {"edit_digit", editDigit},
+  {"edit_keypad", editKeypad},
+  {"edit_typed", editTyped},
+  {"edit_bigint", editBigInt},
+  {"edit_bound", editBound},
+  {"edit_glyphs", editGlyphs},
+  {"edit_touch", editTouch},
+  {"edit_zones", editZones},
+  {"item_list", itemList},
+  {"item_touch", itemTouch},
+  {"item_grid", itemGrid},
+  {"item_filter", itemFilter},
+  {"item_packed", itemPacked},
+  {"item_atlas", itemAtlas},
+};
+
+static std::string readFile(const char *Path) {
+  std::string s;
+  char buf[4096];
+  size_t n;
+  FILE *f = fopen(Path, "r");
+  if (!f) return s;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) s.append(buf, n);
+  fclose(f);
+  return s;
+}
+
+// the first line that differs, so a failure says which step went wrong
+static void firstDiff(const char *Name, const std::string &Want, const std::string &Got) {
+  size_t a = 0, b = 0;
+  int line = 1;
+  char buf[200];
+  while ((a < Want.size()) || (b < Got.size())) {
+    size_t ea = Want.find('\n', a), eb = Got.find('\n', b);
+    std::string la = Want.substr(a, ea - a), lb = Got.substr(b, eb - b);
+    if (la != lb) {
+      snprintf(buf, sizeof(buf), "golden  %s\n        got     %s", la.c_str(), lb.c_str());
+      fail(Name, "log", line, buf);
+      return;
+    }
+    a = (ea == std::string::npos) ? Want.size() : ea + 1;
+    b = (eb == std::string::npos) ? Got.size() : eb + 1;
+    line++;
+  }
+}
+
+int main(int argc, char **argv) {
+
+  const char *dir = GOLDEN_DIR;
+  bool update = false;
+  int picked = 0, ran = 0;
+  char path[512], buf[160];
+  static Adafruit_ST7735 G;
+  int16_t x0, y0, x1, y1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--update")) update = true;
+    else if (!strcmp(argv[i], "--ppm") && (i + 1 < argc)) ppm = argv[++i];
+    else picked++;
+  }
+
+  for (const Scenario &s : scenarios) {
+    bool want = !picked;
+    for (int i = 1; i < argc; i++) {
+      if (!strcmp(argv[i], s.name)) want = true;
+      if (!strcmp(argv[i], "--ppm")) i++;
+    }
+    if (!want) continue;
+
+    // every scenario starts from the same clock and screens
+    g_millis = 0;
+    g_micros = 0;
+    steps.clear();
+    after = nullptr;
+    s.run();
+    ran++;
+
+    snprintf(path, sizeof(path), "%s/%s.txt", dir, s.name);
+    if (update) {
+      FILE *f = fopen(path, "w");
+      if (f) {
+        fputs(steps.c_str(), f);
+        fclose(f);
+      }
+    }
+    else {
+      std::string want = readFile(path);
+      if (want.empty()) fail(s.name, "log", 0, "no golden log, run with --update");
+      else if (want != steps) firstDiff(s.name, want, steps);
+    }
+
+    snprintf(path, sizeof(path), "%s/%s.fb", dir, s.name);
+    if (update) {
+      writeImage(path, D);
+    }
+    else if (!readImage(path, G)) {
+      fail(s.name, "image", 0, "no golden image, run with --update");
+    }
+    else if (int n = screenDiff(D, G, x0, y0, x1, y1)) {
+      snprintf(buf, sizeof(buf), "%d pixels differ from the golden image in %d,%d to %d,%d", n, x0, y0, x1, y1);
+      fail(s.name, "image", 0, buf);
+    }
+
+    if (ppm) {
+      snprintf(path, sizeof(path), "%s/%s.ppm", ppm, s.name);
+      writePPM(path, D);
+    }
+  }
+
+  printf("%d scenarios, %d failed checks%s\n", ran, fails, update ? ", goldens written" : "");
+  return fails ? 1 : 0;
+
+}
@@ -0,0 +1,119 @@
+#include "host.h"
+
+void (*g_delayhook)(unsigned long) = 0;
+thread_local CallStats g_stats;
+unsigned long g_millis = 0, g_micros = 0;
+
+static GFXglyph glyphs[95];
+static struct GlyphInit {
+  GlyphInit() {
+    for (int i = 0; i < 95; i++) {
+      glyphs[i].xAdvance = 6;
+      glyphs[i].width = (i == 0) ? 0 : 5;
+      glyphs[i].height = (i == 0) ? 0 : 7;
+      glyphs[i].yOffset = -6;
+    }
+  }
+} glyphinit;
+GFXfont TestFont = {nullptr, glyphs, 32, 126, 10};
+
+// a square ring, 4 colors, and the same icon through extras/packicon.py
+const uint16_t BOX_565[144] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0xF800, 0x0000,
+  0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const unsigned char BOX_PACKED[] PROGMEM = {
+  0x04, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xE0, 0xFF, 0xC1, 0x92, 0x11, 0x02, 0x70, 0x02, 0x11,
+  0x02, 0x70, 0x02, 0x11, 0x02, 0x10, 0x33, 0x10, 0x02, 0x11, 0x02, 0x10, 0x33, 0x10, 0x02, 0x11,
+  0x02, 0x10, 0x33, 0x10, 0x02, 0x11, 0x02, 0x10, 0x33, 0x10, 0x02, 0x11, 0x02, 0x70, 0x02, 0x11,
+  0x02, 0x70, 0x02, 0x11, 0x92, 0xC1,
+};
+
+const unsigned char BOX_MONO[24] PROGMEM = {
+  0xFF, 0xF0, 0x80, 0x10, 0xBF, 0xD0, 0xA0, 0x50, 0xAF, 0x50, 0xA9, 0x50,
+  0xA9, 0x50, 0xAF, 0x50, 0xA0, 0x50, 0xBF, 0xD0, 0x80, 0x10, 0xFF, 0xF0
+};
+
+uint32_t screenHash(const Adafruit_ST7735 &D) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < D.width() * D.height(); i++) {
+    h = (h ^ (D.fb[i] & 0xFF)) * 16777619u;
+    h = (h ^ (D.fb[i] >> 8)) * 16777619u;
+  }
+  return h;
+}
+
+int screenDiff(const Adafruit_ST7735 &A, const Adafruit_ST7735 &B, int16_t &X0, int16_t &Y0, int16_t &X1, int16_t &Y1) {
+  int n = 0;
+  X0 = Y0 = 32767;
+  X1 = Y1 = -1;
+  for (int y = 0; y < A.height(); y++) {
+    for (int x = 0; x < A.width(); x++) {
+      if (A.fb[y * A.width() + x] != B.fb[y * B.width() + x]) {
+        n++;
+        X0 = min(X0, x);
+        Y0 = min(Y0, y);
+        X1 = max(X1, x);
+        Y1 = max(Y1, y);
+      }
+    }
+  }
+  return n;
+}
+
+bool writeImage(const char *Path, const Adafruit_ST7735 &D) {
+  FILE *f = fopen(Path, "w");
+  int n = D.width() * D.height(), i = 0, runs = 0;
+  if (!f) return false;
+  fprintf(f, "%d %d\n", D.width(), D.height());
+  while (i < n) {
+    int k = 1;
+    while (((i + k) < n) && (D.fb[i + k] == D.fb[i])) k++;
+    fprintf(f, "%x:%x%c", k, D.fb[i], ((++runs % 16) == 0) ? '\n' : ' ');
+    i += k;
+  }
+  fprintf(f, "\n");
+  fclose(f);
+  return true;
+}
+
+bool readImage(const char *Path, Adafruit_ST7735 &D) {
+  FILE *f = fopen(Path, "r");
+  int w, h, i = 0;
+  unsigned k, c;
+  if (!f) return false;
+  if ((fscanf(f, "%d %d", &w, &h) != 2) || (w != D.width()) || (h != D.height())) {
+    fclose(f);
+    return false;
+  }
+  while ((i < w * h) && (fscanf(f, "%x:%x", &k, &c) == 2)) {
+    while (k-- && (i < w * h)) D.fb[i++] = c;
+  }
+  fclose(f);
+  return i == w * h;
+}
+
+bool writePPM(const char *Path, const Adafruit_ST7735 &D) {
+  FILE *f = fopen(Path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", D.width(), D.height());
+  for (int i = 0; i < D.width() * D.height(); i++) {
+    uint16_t c = D.fb[i];
+    fputc((c >> 8) & 0xF8, f);
+    fputc((c >> 3) & 0xFC, f);
+    fputc((c << 3) & 0xF8, f);
+  }
+  fclose(f);
+  return true;
+}
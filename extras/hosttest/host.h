@@ -0,0 +1,24 @@
+// shared by the host tests, a test font, icons, screen hashes and the golden image files
+#pragma once
+#include "Adafruit_ST7735_Menu.h"
+
+// every glyph 5 x 7 with an advance of 6, the stub draws its pixels as a dot pattern
+extern GFXfont TestFont;
+
+extern const uint16_t BOX_565[144];
+extern const unsigned char BOX_PACKED[];
+extern const unsigned char BOX_MONO[24];
+
+// FNV-1a over the panel
+uint32_t screenHash(const Adafruit_ST7735 &D);
+
+// pixels that differ between two panels and the box around them
+int screenDiff(const Adafruit_ST7735 &A, const Adafruit_ST7735 &B, int16_t &X0, int16_t &Y0, int16_t &X1, int16_t &Y1);
+
+// golden images are text, the size then count:color runs in hex, 16 to a line
+bool writeImage(const char *Path, const Adafruit_ST7735 &D);
+
+bool readImage(const char *Path, Adafruit_ST7735 &D);
+
+// binary PPM to look at
+bool writePPM(const char *Path, const Adafruit_ST7735 &D);
@@ -0,0 +1,228 @@
+/*
+
+  value journal tests, EditMenu save() and restore() on a store in RAM
+
+  each check builds menus the way a sketch would across power cycles (a new menu object that
+  restores from the same store) and looks at the values that come back, the store can be told
+  to drop every write after a count to act like power lost part way through a save
+
+*/
+
+#include <string.h>
+#include <new>
+#include "host.h"
+
+// 2 regions of 10 records
+#define STORE_SIZE 160
+
+class RamStore : public MenuStore {
+
+public:
+
+  RamStore() {
+    memset(mem, 0xFF, sizeof(mem));
+  }
+
+  uint8_t read(uint32_t Address) {
+    return (Address < sizeof(mem)) ? mem[Address] : 0xFF;
+  }
+
+  void write(uint32_t Address, uint8_t Data) {
+    if (writes == 0) {
+      return;
+    }
+    if (writes > 0) {
+      writes--;
+    }
+    if (Address < sizeof(mem)) {
+      mem[Address] = Data;
+    }
+  }
+
+  uint8_t mem[STORE_SIZE];
+  long writes = -1;	// bytes written before the power goes, -1 never
+
+};
+
+static Adafruit_ST7735 D;
+static RamStore store;
+static int fails = 0, checks = 0;
+
+static void expect(const char *Check, bool Ok, const char *What) {
+  checks++;
+  if (!Ok) {
+    printf("FAIL %s: %s\n", Check, What);
+    fails++;
+  }
+}
+
+// a power cycle, a new menu of Items items restores from the store, returns what restore() did,
+// Typed makes them int items over the whole int32 range
+static int boot(EditMenu &E, int Items, bool Typed = false) {
+  new(&E) EditMenu(&D);
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Journal", TestFont, TestFont);
+  for (int k = 1; k <= Items; k++) {
+    if (Typed) {
+      E.addInt("int", 0, INT32_MIN, INT32_MAX);
+    }
+    else {
+      E.addNI("val", 0, 0, 100, 1, 0);
+    }
+  }
+  E.setStore(&store, 0, STORE_SIZE);
+  return E.restore();
+}
+
+static bool holds(EditMenu &E, int Items, float Base) {
+  for (int k = 1; k <= Items; k++) {
+    if (E.value[k] != Base + k) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void set(EditMenu &E, int Items, float Base) {
+  for (int k = 1; k <= Items; k++) {
+    E.value[k] = Base + k;
+  }
+}
+
+// a record the way version 1 of the journal wrote it, a float and the library's crc-8
+static void oldRecord(int Region, int Slot, uint16_t Epoch, uint8_t ID, float Value) {
+  uint8_t *rec = &store.mem[(Region * (STORE_SIZE / 2 / JOURNAL_RECORD) + Slot) * JOURNAL_RECORD];
+  uint8_t crc = 0xFF;
+  rec[0] = Epoch & 0xFF;
+  rec[1] = Epoch >> 8;
+  rec[2] = ID;
+  memcpy(&rec[3], &Value, sizeof(float));
+  for (int k = 0; k < JOURNAL_RECORD - 1; k++) {
+    crc ^= rec[k];
+    for (int b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+  }
+  rec[JOURNAL_RECORD - 1] = crc;
+}
+
+// the version in the newest marker, 0 when there is none
+static uint32_t markerVersion() {
+  uint32_t v, best = 0;
+  int newest = -1;
+  for (int r = 0; r < 2; r++) {
+    for (int k = 0; k < STORE_SIZE / 2 / JOURNAL_RECORD; k++) {
+      uint8_t *rec = &store.mem[(r * (STORE_SIZE / 2 / JOURNAL_RECORD) + k) * JOURNAL_RECORD];
+      int e = rec[0] | (rec[1] << 8);
+      if ((rec[2] == 0) && (e > newest)) {
+        memcpy(&v, &rec[3], sizeof(v));
+        best = v;
+        newest = e;
+      }
+    }
+  }
+  return best;
+}
+
+int main() {
+
+  // boot() builds a new menu in the same place each power cycle
+  alignas(EditMenu) static char mem[sizeof(EditMenu)];
+  EditMenu &E = *new(mem) EditMenu(&D);
+
+  // blank store, nothing comes back
+  store = RamStore();
+  expect("blank", boot(E, 3) == 0, "restore() found values in a blank store");
+
+  // values come back after a save
+  set(E, 3, 10);
+  E.save();
+  expect("save", (boot(E, 3) == 3) && holds(E, 3, 10), "values did not come back");
+
+  // edits go on after the first region fills and the journal moves to the other one
+  for (int k = 0; k < 12; k++) {
+    E.value[1 + (k % 3)] += 1;
+    E.save();
+  }
+  float v1 = E.value[1], v2 = E.value[2], v3 = E.value[3];
+  expect("laps", (boot(E, 3) == 3) && (E.value[1] == v1) && (E.value[2] == v2) && (E.value[3] == v3),
+         "edits over several region changes did not come back");
+
+  // an item added since the last save, the journal holds 3 of 4, the save after the restore
+  // has to land past the newest region or the next boot rolls back to it
+  expect("partial restore", boot(E, 4) == 3, "restore() of 3 saved items in a menu of 4");
+  set(E, 4, 20);
+  E.save();
+  expect("partial save", (boot(E, 4) == 4) && holds(E, 4, 20), "the save after a partial restore rolled back");
+  E.value[2] = 50;
+  E.save();
+  expect("partial edit", (boot(E, 4) == 4) && (E.value[2] == 50), "an edit after a partial restore was lost");
+
+  // power lost part way through the full copy, the region before it is still there, one
+  // edit appends 8 bytes and a full copy of 4 items writes 40 so 20 only cuts the copy short
+  boot(E, 4);
+  v1 = E.value[1];
+  v2 = E.value[2];
+  bool cut = false;
+  for (int k = 0; (k < 20) && (!cut); k++) {
+    E.value[1] += 1;
+    store.writes = 20;
+    E.save();
+    cut = (store.writes == 0);
+    if (!cut) {
+      v1 = E.value[1];
+    }
+  }
+  store.writes = -1;
+  expect("power loss", cut && (boot(E, 4) == 4) && (E.value[1] == v1) && (E.value[2] == v2),
+         "a save cut short lost the values before it");
+
+  // a menu that saves without restoring first still goes past what is in the store
+  new(&E) EditMenu(&D);
+  E.init(ST7735_WHITE, ST7735_BLACK, ST7735_RED, ST7735_BLUE, ST7735_GREEN, 0x3333, 85, 20, 4, "Journal", TestFont, TestFont);
+  for (int k = 1; k <= 4; k++) {
+    E.addNI("val", 0, 0, 100, 1, 0);
+  }
+  E.setStore(&store, 0, STORE_SIZE);
+  set(E, 4, 30);
+  E.save();
+  expect("no restore", (boot(E, 4) == 4) && holds(E, 4, 30), "a save without a restore() rolled back");
+
+  // an int past 2^24 comes back whole, as a float 20000001 would round to 20000000
+  store = RamStore();
+  boot(E, 2, true);
+  E.setInt(1, 20000001);
+  E.setInt(2, -20000003);
+  E.save();
+  expect("int", (boot(E, 2, true) == 2) && (E.getInt(1) == 20000001) && (E.getInt(2) == -20000003),
+         "an int item past 2^24 came back rounded");
+
+  // and one at the very top of the range, INT32_MAX - 1 is the same float as INT32_MAX
+  E.setInt(1, INT32_MAX - 1);
+  E.setInt(2, INT32_MIN + 1);
+  E.save();
+  expect("int32 max", (boot(E, 2, true) == 2) && (E.getInt(1) == INT32_MAX - 1) && (E.getInt(2) == INT32_MIN + 1),
+         "an int item near INT32_MAX came back changed");
+
+  // a journal from version 1, floats and a marker holding 0, still restores and the first save
+  // after it copies everything out in the new format, typed items read back from the float
+  store = RamStore();
+  oldRecord(0, 0, 7, 1, 12);
+  oldRecord(0, 1, 7, 2, 34);
+  oldRecord(0, 2, 7, 0, 0);
+  oldRecord(0, 3, 7, 2, 35);
+  expect("version 1", (boot(E, 2) == 2) && (E.value[1] == 12) && (E.value[2] == 35),
+         "a version 1 journal did not restore");
+  E.value[1] = 13;
+  E.save();
+  expect("version 1 save", (markerVersion() == JOURNAL_VERSION) && (boot(E, 2) == 2) && (E.value[1] == 13) &&
+         (E.value[2] == 35), "the save after a version 1 restore did not rewrite the journal");
+  store = RamStore();
+  oldRecord(0, 0, 7, 1, 16777216);
+  oldRecord(0, 1, 7, 0, 0);
+  expect("version 1 int", (boot(E, 1, true) == 1) && (E.getInt(1) == 16777216),
+         "a typed item from a version 1 journal came back wrong");
+
+  printf("%d journal checks, %d failed\n", checks, fails);
+  return fails ? 1 : 0;
+
+}
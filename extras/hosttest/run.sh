@@ -0,0 +1,38 @@
+#!/bin/sh
+# builds the host tests with the sanitizers and runs them, needs only g++ (or $CXX)
+#
+#   ./run.sh                    golden image suite, the value journal checks, then the fuzz test
+#                               with seeds 1 to 4
+#   ./run.sh edit_list ...      some scenarios
+#   ./run.sh --update           write the goldens again after a change meant to alter the screens
+#   ./run.sh --ppm /tmp/shots   also write the screens as images
+#   ./run.sh fuzz SEED [RUNS]   the fuzz test alone, the same seed plays the same runs
+#   ./run.sh bench              raw against packed icon decode, optimised and without the sanitizers
+
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+FLAGS="-std=gnu++11 -g -O1 -Wall -Wextra -fsanitize=address,undefined -fno-sanitize-recover=all -Istub -I. -I../.."
+export ASAN_OPTIONS=detect_leaks=0
+
+mkdir -p build
+if [ "$1" = bench ]; then
+  $CXX -std=gnu++11 -O2 -Istub -I. -I../.. -o build/bench bench.cpp host.cpp ../../Adafruit_ST7735_Menu.cpp
+  exec ./build/bench
+fi
+if [ "$1" = fuzz ]; then
+  shift
+  $CXX $FLAGS -o build/fuzz fuzz.cpp host.cpp ../../Adafruit_ST7735_Menu.cpp
+  exec ./build/fuzz "$@"
+fi
+
+$CXX $FLAGS -DGOLDEN_DIR='"golden"' -o build/golden golden.cpp host.cpp ../../Adafruit_ST7735_Menu.cpp
+./build/golden "$@"
+if [ $# -eq 0 ]; then
+  $CXX $FLAGS -o build/journal journal.cpp host.cpp ../../Adafruit_ST7735_Menu.cpp
+  ./build/journal
+  $CXX $FLAGS -o build/fuzz fuzz.cpp host.cpp ../../Adafruit_ST7735_Menu.cpp
+  for seed in 1 2 3 4; do
+    ./build/fuzz $seed
+  done
+fi
@@ -0,0 +1,117 @@
+// a small Adafruit_GFX for the host tests, shapes end up as drawPixel calls on the subclass and
+// g_stats counts the calls a menu makes, text draws every glyph as a fixed dot pattern so each
+// character leaves its own pixels without needing the font bitmaps
+#pragma once
+#include "Arduino.h"
+
+typedef struct { uint16_t bitmapOffset; uint8_t width, height, xAdvance; int8_t xOffset, yOffset; } GFXglyph;
+typedef struct { uint8_t *bitmap; GFXglyph *glyph; uint16_t first, last; uint8_t yAdvance; } GFXfont;
+
+// pixels is what reaches the panel, the rest count calls into the GFX API, bursts are the
+// writePixels and writeColor calls and burstpx the pixels they carry
+struct CallStats { long pixels = 0, fills = 0, tris = 0, chars = 0, windows = 0, bursts = 0, burstpx = 0; };
+extern thread_local CallStats g_stats;
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t c) = 0;
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t c) { drawPixel(x, y, c); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) { for (int j = 0; j < h; j++) for (int i = 0; i < w; i++) drawPixel(x + i, y + j, c); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) { writeFillRect(x, y, w, 1, c); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) { writeFillRect(x, y, 1, h, c); }
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) { g_stats.fills++; writeFillRect(x, y, w, h, c); }
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) { fillRect(x, y, w, 1, c); }
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) { fillRect(x, y, 1, h, c); }
+  virtual void fillScreen(uint16_t c) { fillRect(0, 0, _width, _height, c); }
+  // corners are left square, the tests compare screens with each other, not with a panel
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t c) { (void) r; fillRect(x, y, w, h, c); }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) { fillRect(x, y, w, 1, c); fillRect(x, y + h - 1, w, 1, c); fillRect(x, y, 1, h, c); fillRect(x + w - 1, y, 1, h, c); }
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t c) { (void) r; drawRect(x, y, w, h, c); }
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t c) {
+    g_stats.tris++;
+    if (y0 > y1) { swap(x0, x1); swap(y0, y1); }
+    if (y1 > y2) { swap(x1, x2); swap(y1, y2); }
+    if (y0 > y1) { swap(x0, x1); swap(y0, y1); }
+    for (int y = y0; y <= y2; y++) {
+      int a = edge(x0, y0, x2, y2, y), b = (y < y1) ? edge(x0, y0, x1, y1, y) : edge(x1, y1, x2, y2, y);
+      if (a > b) { int t = a; a = b; b = t; }
+      writeFillRect(a, y, b - a + 1, 1, c);
+    }
+  }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+    int dx = abs(x1 - x0), dy = -abs(y1 - y0), sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1, e = dx + dy;
+    for (;;) {
+      drawPixel(x0, y0, c);
+      if ((x0 == x1) && (y0 == y1)) break;
+      if (2 * e >= dy) { e += dy; x0 += sx; }
+      if (2 * e <= dx) { e += dx; y0 += sy; }
+    }
+  }
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *b, int16_t w, int16_t h) { for (int j = 0; j < h; j++) for (int i = 0; i < w; i++) drawPixel(x + i, y + j, b[j * w + i]); }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *b, int16_t w, int16_t h, uint16_t c) { int bw = (w + 7) / 8; for (int j = 0; j < h; j++) for (int i = 0; i < w; i++) if (b[j * bw + i / 8] & (0x80 >> (i & 7))) drawPixel(x + i, y + j, c); }
+  void drawChar(int16_t x, int16_t y, unsigned char ch, uint16_t c, uint16_t bg, uint8_t s) { (void) ch; (void) bg; (void) s; fillRect(x, y - 6, 5, 7, c); }
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t b) { textcolor = c; textbgcolor = b; }
+  void setTextSize(uint8_t) {}
+  void setTextWrap(bool w) { wrap = w; }
+  void setFont(const GFXfont *f = NULL) { gfxFont = (GFXfont *) f; }
+  void getTextBounds(const char *s, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) { *x1 = x; *y1 = y - 7; *w = 6 * strlen(s); *h = 8; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return 1; }
+  void setRotation(uint8_t) {}
+  virtual size_t write(uint8_t c) {
+    g_stats.chars++;
+    if (c == '\n') { cursor_y += 8; cursor_x = 0; return 1; }
+    if (!gfxFont) { fillRect(cursor_x, cursor_y - 6, 5, 7, textcolor); cursor_x += 6; return 1; }
+    if ((c < gfxFont->first) || (c > gfxFont->last)) return 1;
+    GFXglyph *g = &gfxFont->glyph[c - gfxFont->first];
+    if ((g->width > 0) && (g->height > 0)) {
+      if (wrap && ((cursor_x + textsize_x * (g->xOffset + g->width)) > _width)) { cursor_x = 0; cursor_y += gfxFont->yAdvance; }
+      for (int k = 0; k < g->width; k++)
+        for (int r = 0; r < g->height; r++)
+          if (((c * 7 + k * 3 + r * 5) % 5) < 3) drawPixel(cursor_x + g->xOffset + k, cursor_y + g->yOffset + r, textcolor);
+    }
+    cursor_x += g->xAdvance;
+    return 1;
+  }
+  using Print::write;
+protected:
+  static void swap(int16_t &a, int16_t &b) { int16_t t = a; a = b; b = t; }
+  static int edge(int x0, int y0, int x1, int y1, int y) { return (y1 == y0) ? x1 : x0 + ((x1 - x0) * (y - y0)) / (y1 - y0); }
+  int16_t _width, _height, cursor_x = 0, cursor_y = 0;
+  uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+  bool wrap = true;
+  GFXfont *gfxFont = NULL;
+  uint8_t textsize_x = 1, textsize_y = 1;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+public:
+  GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) { buffer = (uint16_t *) calloc(w * h, 2); }
+  ~GFXcanvas16() { free(buffer); }
+  void drawPixel(int16_t x, int16_t y, uint16_t c) { if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return; buffer[y * _width + x] = c; }
+  uint16_t getPixel(int16_t x, int16_t y) const { if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return 0; return buffer[y * _width + x]; }
+  uint16_t *getBuffer() const { return buffer; }
+  void fillScreen(uint16_t c) { for (int i = 0; i < _width * _height; i++) buffer[i] = c; }
+private:
+  uint16_t *buffer;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) { buffer = (uint8_t *) calloc(((w + 7) / 8) * h, 1); }
+  ~GFXcanvas1() { free(buffer); }
+  void drawPixel(int16_t x, int16_t y, uint16_t c) { if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return; uint8_t *p = &buffer[y * ((_width + 7) / 8) + x / 8]; if (c) *p |= 0x80 >> (x & 7); else *p &= ~(0x80 >> (x & 7)); }
+  bool getPixel(int16_t x, int16_t y) const { return buffer[y * ((_width + 7) / 8) + x / 8] & (0x80 >> (x & 7)); }
+  uint8_t *getBuffer() const { return buffer; }
+  void fillScreen(uint16_t c) { memset(buffer, c ? 0xFF : 0, ((_width + 7) / 8) * _height); }
+private:
+  uint8_t *buffer;
+};
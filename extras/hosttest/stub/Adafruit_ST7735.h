@@ -0,0 +1,47 @@
+// a 160 x 128 ST7735 whose panel is the fb array, windows and pixel writes land in it like
+// they would go over SPI
+#pragma once
+#include "Adafruit_GFX.h"
+
+#define ST77XX_DISPOFF 0x28
+#define ST77XX_DISPON 0x29
+#define ST77XX_SLPIN 0x10
+#define ST77XX_SLPOUT 0x11
+#define INITR_GREENTAB 0
+
+#define ST7735_BLACK 0x0000
+#define ST7735_WHITE 0xFFFF
+#define ST7735_BLUE 0x001F
+#define ST7735_RED 0xF800
+#define ST7735_GREEN 0x07E0
+
+class Adafruit_SPITFT : public Adafruit_GFX {
+public:
+  Adafruit_SPITFT(int16_t w, int16_t h) : Adafruit_GFX(w, h) { fb = (uint16_t *) calloc(w * h, 2); }
+  ~Adafruit_SPITFT() { free(fb); }
+  uint16_t *fb;
+  int16_t wx = 0, wy = 0, ww = 0, wh = 0;
+  long wp = 0;
+  bool on = true, sleeping = false;
+  void drawPixel(int16_t x, int16_t y, uint16_t c) { g_stats.pixels++; if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return; fb[y * _width + x] = c; }
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) { g_stats.windows++; wx = x; wy = y; ww = w; wh = h; wp = 0; }
+  void writePixels(uint16_t *c, uint32_t n, bool block = true, bool big = false) { (void) block; (void) big; g_stats.bursts++; g_stats.burstpx += n; while (n--) { drawPixel(wx + wp % ww, wy + wp / ww, *c++); wp++; } }
+  void writeColor(uint16_t c, uint32_t n) { g_stats.bursts++; g_stats.burstpx += n; while (n--) { drawPixel(wx + wp % ww, wy + wp / ww, c); wp++; } }
+  void pushColor(uint16_t c) { writeColor(c, 1); }
+  void sendCommand(uint8_t cmd, const uint8_t *d = NULL, uint8_t n = 0) { (void) d; (void) n; if (cmd == ST77XX_DISPOFF) on = false; if (cmd == ST77XX_DISPON) on = true; }
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+};
+
+class Adafruit_ST77xx : public Adafruit_SPITFT {
+public:
+  Adafruit_ST77xx(int16_t w, int16_t h) : Adafruit_SPITFT(w, h) {}
+  void enableDisplay(boolean e) { on = e; }
+  void enableSleep(boolean e) { sleeping = e; }
+};
+
+class Adafruit_ST7735 : public Adafruit_ST77xx {
+public:
+  Adafruit_ST7735(int8_t, int8_t, int8_t) : Adafruit_ST77xx(160, 128) {}
+  Adafruit_ST7735() : Adafruit_ST77xx(160, 128) {}
+  void initR(uint8_t) {}
+};
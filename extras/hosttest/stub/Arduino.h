@@ -0,0 +1,44 @@
+// just enough of Arduino.h to build the library on a PC, millis() and micros() only move
+// when a test moves g_millis and g_micros, delay() moves millis
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdio.h>
+
+// defined like on a board unless HOST_NO_ARDUINO, which builds the PC only parts
+// (MenuFileStore, MenuStdThread) instead
+#ifndef HOST_NO_ARDUINO
+#define ARDUINO 10800
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(a) (*(const uint8_t *) (a))
+#define pgm_read_word(a) (*(const uint16_t *) (a))
+#define pgm_read_word_near(a) (*(const uint16_t *) (a))
+#define pgm_read_dword(a) (*(const uint32_t *) (a))
+#define pgm_read_ptr(a) (*(void * const *) (a))
+#define pgm_read_float(a) (*(const float *) (a))
+#define F(s) ((const __FlashStringHelper *) (s))
+#define PSTR(s) (s)
+
+extern unsigned long g_millis;
+extern unsigned long g_micros;
+extern void (*g_delayhook)(unsigned long);
+
+inline unsigned long millis() { return g_millis; }
+inline unsigned long micros() { return g_micros; }
+inline void delay(unsigned long ms) { if (g_delayhook) g_delayhook(ms); g_millis += ms; g_micros += ms * 1000; }
+inline void delayMicroseconds(unsigned) {}
+inline void yield() {}
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(x, l, h) ((x) < (l) ? (l) : ((x) > (h) ? (h) : (x)))
+#define abs(x) ((x) > 0 ? (x) : -(x))
+
+#include "Print.h"
@@ -0,0 +1,30 @@
+// Print as the cores have it, numbers are formatted with printf
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+#define DEC 10
+#define HEX 16
+
+class __FlashStringHelper;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) { size_t r = 0; while (n--) r += write(*b++); return r; }
+  size_t write(const char *s) { return write((const uint8_t *) s, strlen(s)); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *) s); }
+  size_t print(char c) { return write((uint8_t) c); }
+  size_t print(int v, int base = DEC) { char b[24]; snprintf(b, 24, base == 16 ? "%x" : "%d", v); return write(b); }
+  size_t print(unsigned v, int base = DEC) { char b[24]; snprintf(b, 24, base == 16 ? "%x" : "%u", v); return write(b); }
+  size_t print(long v, int base = DEC) { char b[24]; snprintf(b, 24, base == 16 ? "%lx" : "%ld", v); return write(b); }
+  size_t print(unsigned long v, int base = DEC) { char b[24]; snprintf(b, 24, base == 16 ? "%lx" : "%lu", v); return write(b); }
+  size_t print(double v, int d = 2) { char b[48]; snprintf(b, 48, "%.*f", d, v); return write(b); }
+  size_t println() { return write("\r\n"); }
+  template<class T> size_t println(T v) { size_t r = print(v); return r + println(); }
+  template<class T> size_t println(T v, int d) { size_t r = print(v, d); return r + println(); }
+};
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+menusize.py - flash and RAM the menu library takes, feature by feature
+
+Compiles Examples/Menu_MemoryReport with arduino-cli once with no features, once for each
+feature flag and once with all of them, and prints the flash and static RAM of each build
+and what the flag added to the first one. With --flash and --ram it exits with 1 when the
+build with all the features is over either budget, so it can run as a CI step.
+
+  python3 menusize.py --fqbn arduino:avr:mega
+  python3 menusize.py --fqbn esp32:esp32:esp32 --flash 400000 --ram 40000
+  python3 menusize.py --fqbn teensy:avr:teensyLC MENU_SIZE_TOUCH MENU_ITEM_RAM=0
+  python3 menusize.py --fqbn arduino:avr:uno -D MAX_OPT=8 -D MAX_CHAR_LEN=16 --ram 1500
+
+The flags are MENU_SIZE_ ones from the sketch (turning on a feature) and library ones like
+MENU_ITEM_RAM=0, MENU_BIND=0 or MAX_OPT=8, a flag without a value is set to 1. -D flags go
+into every build, the one with no features too, so MAX_OPT and MAX_CHAR_LEN can set the menu
+size the budgets are checked at. The board core and the Adafruit GFX and ST7735 libraries must be
+installed. RAM here is what the linker places, menus declared as globals are in it, heap (a
+MenuCanvas, the touch strip) is not. The sketch prints the RAM of each menu object field by
+field over Serial, set MENU_EDIT_BUDGET / MENU_ITEM_BUDGET in it to fail the build when a menu
+gets too big.
+
+Flags are passed with --build-property compiler.cpp.extra_flags, the AVR and ESP32 cores
+leave that empty for this, use --property for a core that does not.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+FEATURES = [
+    'MENU_SIZE_TOUCH',
+    'MENU_SIZE_FRAMES',
+    'MENU_SIZE_SLIDE',
+    'MENU_SIZE_IDLE',
+    'MENU_SIZE_GRID',
+    'MENU_SIZE_BIND',
+    'MENU_SIZE_DIGIT',
+    'MENU_SIZE_FILTER',
+    'MENU_SIZE_LIST',
+    'MENU_SIZE_CANVAS',
+    'MENU_ITEM_RAM=0',
+    'MENU_BIND=0',
+    'MENU_FILTER=0',
+    'MENU_PROFILE',
+]
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LIBRARY = os.path.dirname(HERE)
+SKETCH = os.path.join(LIBRARY, 'Examples', 'Menu_MemoryReport')
+
+
+def define(flag):
+    return '-D' + (flag if '=' in flag else flag + '=1')
+
+
+def build(args, flags):
+    cmd = ['arduino-cli', 'compile', '--fqbn', args.fqbn, '--library', LIBRARY,
+           '--build-path', args.build_path,
+           '--build-property', args.property + '=' + ' '.join(define(f) for f in args.define + flags),
+           SKETCH]
+    run = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if run.returncode != 0:
+        sys.stderr.write(run.stdout)
+        sys.exit('build failed with ' + (' '.join(flags) or 'no flags'))
+    flash = re.search(r'Sketch uses (\d+) bytes', run.stdout)
+    ram = re.search(r'Global variables use (\d+) bytes', run.stdout)
+    if not flash:
+        sys.stderr.write(run.stdout)
+        sys.exit('no size in the arduino-cli output')
+    return int(flash.group(1)), int(ram.group(1)) if ram else 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description='flash and RAM of the menu library feature by feature')
+    ap.add_argument('--fqbn', required=True, help='board, as arduino-cli board listall shows it')
+    ap.add_argument('--flash', type=int, help='flash budget in bytes for the build with all the flags')
+    ap.add_argument('--ram', type=int, help='static RAM budget in bytes for the build with all the flags')
+    ap.add_argument('--property', default='compiler.cpp.extra_flags', help='build property the flags go in')
+    ap.add_argument('-D', '--define', action='append', default=[], metavar='FLAG',
+                    help='flag for every build, like MAX_OPT=8 or MAX_CHAR_LEN=16')
+    ap.add_argument('flags', nargs='*', help='flags to measure, all of them when none are given')
+    args = ap.parse_args()
+    flags = args.flags or FEATURES
+
+    with tempfile.TemporaryDirectory() as tmp:
+        args.build_path = tmp
+        base = build(args, [])
+        print('%-22s %8s %8s %8s %8s' % ('', 'flash', '+flash', 'ram', '+ram'))
+        print('%-22s %8d %8s %8d %8s' % ('none', base[0], '', base[1], ''))
+        for f in flags:
+            s = build(args, [f])
+            print('%-22s %8d %+8d %8d %+8d' % (f, s[0], s[0] - base[0], s[1], s[1] - base[1]))
+        full = build(args, flags) if len(flags) > 1 else s
+        print('%-22s %8d %+8d %8d %+8d' % ('all', full[0], full[0] - base[0], full[1], full[1] - base[1]))
+
+    over = []
+    if (args.flash is not None) and (full[0] > args.flash):
+        over.append('flash %d is over %d' % (full[0], args.flash))
+    if (args.ram is not None) and (full[1] > args.ram):
+        over.append('ram %d is over %d' % (full[1], args.ram))
+    if over:
+        sys.exit(', '.join(over))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+packicon.py - packs a RGB565 icon into the ICON_PACKED format used by addPacked / MenuPacked
+
+The input is either the C array image2cpp writes for a 565 bitmap (any text with the
+0xNNNN words in order) or, when Pillow is installed, an image file. The output is a
+PROGMEM byte array to paste into the sketch.
+
+  python3 packicon.py icon.h 32 32 ICON_WIFI > icon_wifi.h
+  python3 packicon.py icon.png ICON_WIFI > icon_wifi.h
+
+Format, read by MenuUnpack in Adafruit_ST7735_Menu.cpp
+  byte 0      palette size n, 1 to 255
+  2n bytes    palette, RGB565 low byte first
+  runs        left to right, top to bottom, a run may carry on into the next row
+              n <= 16  one byte, run length - 1 in the high nibble, palette index in the low
+              n > 16   two bytes, run length - 1 then palette index
+"""
+
+import re
+import sys
+
+
+def read_array(path, w, h):
+    text = open(path).read()
+    # drop comments so numbers in them are not taken as pixels
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    words = [int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{1,4})\b', text)]
+    if len(words) < w * h:
+        sys.exit('%s: %d pixels, %dx%d needs %d' % (path, len(words), w, h, w * h))
+    return words[-w * h:]
+
+
+def read_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('reading images needs Pillow, or pass an image2cpp array with width and height')
+    img = Image.open(path).convert('RGB')
+    w, h = img.size
+    px = [((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3) for r, g, b in img.getdata()]
+    return px, w, h
+
+
+def pack(px):
+    # most used colors first, so the common ones get the short indexes
+    count = {}
+    for p in px:
+        count[p] = count.get(p, 0) + 1
+    palette = sorted(count, key=lambda p: -count[p])
+    if len(palette) > 255:
+        sys.exit('%d colors, reduce the icon to 255 or fewer' % len(palette))
+    index = {p: i for i, p in enumerate(palette)}
+    small = len(palette) <= 16
+    longest = 16 if small else 256
+
+    out = [len(palette)]
+    for p in palette:
+        out += [p & 0xFF, p >> 8]
+    i = 0
+    while i < len(px):
+        n = 1
+        while (i + n < len(px)) and (px[i + n] == px[i]) and (n < longest):
+            n += 1
+        if small:
+            out.append(((n - 1) << 4) | index[px[i]])
+        else:
+            out += [n - 1, index[px[i]]]
+        i += n
+    return out, len(palette)
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 4:
+        w, h = int(args[1]), int(args[2])
+        px = read_array(args[0], w, h)
+    elif len(args) == 2:
+        px, w, h = read_image(args[0])
+    else:
+        sys.exit(__doc__)
+    name = args[-1]
+    data, colors = pack(px)
+
+    print('// %dx%d, %d colors, %d bytes packed, %d bytes as raw 565' % (w, h, colors, len(data), w * h * 2))
+    print('const unsigned char %s[] PROGMEM = {' % name)
+    for i in range(0, len(data), 16):
+        print('  ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    print('};')
+
+
+if __name__ == '__main__':
+    main()